@@ -0,0 +1,157 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2014, 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "accessibilite.h"
+#include "graphe.h"
+#include "composantes.h"
+#include "outils.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+struct Accessibilite {
+	int nb_etats;
+	int * etats;                //!< Indice -> état, trié.
+	int * composante;           //!< Indice d'état -> composante.
+	int nb_composantes;
+	size_t nb_mots;             //!< Nombre de mots de 64 bits par ligne.
+	uint64_t * lignes;          //!< La ligne de la composante c commence au mot c*nb_mots.
+};
+
+size_t memoire_lignes_accessibilite( int nb_etats, int nb_composantes ){
+	return sizeof(Accessibilite) + (size_t) nb_etats * 2 * sizeof(int)
+		+ (size_t) nb_composantes * NB_MOTS_BITS( nb_composantes ) * sizeof(uint64_t);
+}
+
+size_t estimer_memoire_accessibilite( const Automate * automate ){
+	Graphe * graphe = creer_graphe( automate );
+	Composantes * composantes = creer_composantes( graphe );
+	size_t memoire = memoire_lignes_accessibilite( 
+		graphe->nb_etats, composantes->nb_composantes 
+	);
+	liberer_composantes( composantes );
+	liberer_graphe( graphe );
+	return memoire;
+}
+
+Statut_budget creer_accessibilite_budget(
+	const Automate * automate, Budget * budget, Accessibilite ** resultat
+){
+	*resultat = NULL;
+	Graphe * graphe = creer_graphe( automate );
+	Composantes * composantes = creer_composantes( graphe );
+	int nb_composantes = composantes->nb_composantes;
+	Statut_budget statut = verifier_budget( 
+		budget, nb_composantes, 
+		memoire_lignes_accessibilite( graphe->nb_etats, nb_composantes ) 
+	);
+	if( statut != BUDGET_RESPECTE ){
+		liberer_composantes( composantes );
+		liberer_graphe( graphe );
+		return statut;
+	}
+
+	Accessibilite * res = xmalloc( sizeof(Accessibilite) );
+	res->nb_etats = graphe->nb_etats;
+	res->etats = xmalloc( ( graphe->nb_etats + 1 ) * sizeof(int) );
+	memcpy( res->etats, graphe->etats, graphe->nb_etats * sizeof(int) );
+	res->composante = xmalloc( ( graphe->nb_etats + 1 ) * sizeof(int) );
+	memcpy( 
+		res->composante, composantes->composante, graphe->nb_etats * sizeof(int) 
+	);
+	res->nb_composantes = nb_composantes;
+	res->nb_mots = NB_MOTS_BITS( nb_composantes );
+	res->lignes = xmalloc( 
+		( (size_t) nb_composantes * res->nb_mots + 1 ) * sizeof(uint64_t) 
+	);
+	memset( 
+		res->lignes, 0, (size_t) nb_composantes * res->nb_mots * sizeof(uint64_t) 
+	);
+
+	// Les successeurs d'une composante ont des numéros plus grands : leurs 
+	// lignes sont complètes quand on la traite.
+	int c, k;
+	size_t m;
+	for( c=nb_composantes-1; c>=0; c-- ){
+		uint64_t * ligne = &res->lignes[ (size_t) c * res->nb_mots ];
+		METTRE_BIT( ligne, c );
+		for( 
+			k=composantes->debut_successeurs[c]; 
+			k<composantes->debut_successeurs[c+1]; 
+			k++ 
+		){
+			const uint64_t * successeur = 
+				&res->lignes[ (size_t) composantes->successeurs[k] * res->nb_mots ];
+			// Les bits d'une ligne sont tous au moins égaux à son numéro.
+			for( m=(size_t) c / 64; m<res->nb_mots; m++ ){
+				ligne[m] |= successeur[m];
+			}
+		}
+	}
+
+	liberer_composantes( composantes );
+	liberer_graphe( graphe );
+	*resultat = res;
+	return BUDGET_RESPECTE;
+}
+
+Accessibilite * creer_accessibilite( const Automate * automate ){
+	Accessibilite * res;
+	creer_accessibilite_budget( automate, NULL, &res );
+	return res;
+}
+
+void liberer_accessibilite( Accessibilite * accessibilite ){
+	xfree( accessibilite->etats );
+	xfree( accessibilite->composante );
+	xfree( accessibilite->lignes );
+	xfree( accessibilite );
+}
+
+size_t memoire_accessibilite( const Accessibilite * accessibilite ){
+	return memoire_lignes_accessibilite( 
+		accessibilite->nb_etats, accessibilite->nb_composantes 
+	);
+}
+
+int indice_etat_accessibilite( const Accessibilite * accessibilite, int etat ){
+	int debut = 0;
+	int fin = accessibilite->nb_etats;
+	while( debut < fin ){
+		int milieu = debut + ( fin - debut ) / 2;
+		if( accessibilite->etats[milieu] < etat ){
+			debut = milieu + 1;
+		}else{
+			fin = milieu;
+		}
+	}
+	return debut < accessibilite->nb_etats && accessibilite->etats[debut] == etat ?
+		debut : -1;
+}
+
+bool peut_atteindre( const Accessibilite * accessibilite, int origine, int fin ){
+	int i = indice_etat_accessibilite( accessibilite, origine );
+	int j = indice_etat_accessibilite( accessibilite, fin );
+	if( i < 0 || j < 0 ) return origine == fin;
+	const uint64_t * ligne = &accessibilite->lignes[ 
+		(size_t) accessibilite->composante[i] * accessibilite->nb_mots 
+	];
+	return TESTER_BIT( ligne, accessibilite->composante[j] );
+}
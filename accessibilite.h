@@ -0,0 +1,105 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2014, 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file accessibilite.h */ 
+
+#ifndef __ACCESSIBILITE_H__
+#define __ACCESSIBILITE_H__
+
+#include "automate.h"
+#include "budget.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+
+/**
+ * @brief Relation d'accessibilité entre tous les couples d'états d'un 
+ * automate, précalculée.
+ *
+ * Chaque composante fortement connexe (voir composantes.h) reçoit une ligne 
+ * de bits qui donne les composantes qu'elle atteint. Les lignes sont 
+ * calculées dans l'ordre topologique inverse, par des ou bit à bit sur des 
+ * mots de 64 bits : la mémoire occupée est de l'ordre de 
+ * nb_composantes^2 / 8 octets.
+ *
+ * Un état atteint toujours lui-même, comme avec etats_accessibles().
+ */
+typedef struct Accessibilite Accessibilite;
+
+/**
+ * @brief Renvoie la mémoire, en octets, qu'occuperait la relation 
+ * d'accessibilité d'un automate, sans la construire.
+ *
+ * @param automate Un automate.
+ * @return La mémoire nécessaire.
+ */
+size_t estimer_memoire_accessibilite( const Automate * automate );
+
+/**
+ * @brief Construit la relation d'accessibilité d'un automate.
+ *
+ * @param automate Un automate.
+ * @return La relation, indépendante de l'automate du point de vue de la 
+ *         mémoire.
+ */
+Accessibilite * creer_accessibilite( const Automate * automate );
+
+/**
+ * @brief Construit la relation d'accessibilité d'un automate, si sa mémoire 
+ * respecte un budget.
+ *
+ * La mémoire est vérifiée avant la construction des lignes de bits.
+ *
+ * @param automate Un automate.
+ * @param budget Le budget (voir budget.h), ou NULL.
+ * @param resultat Reçoit la relation, ou NULL en cas d'abandon.
+ * @return BUDGET_RESPECTE, ou la raison de l'abandon.
+ */
+Statut_budget creer_accessibilite_budget(
+	const Automate * automate, Budget * budget, Accessibilite ** resultat
+);
+
+/**
+ * @brief Détruit une relation d'accessibilité.
+ *
+ * @param accessibilite La relation à détruire.
+ */
+void liberer_accessibilite( Accessibilite * accessibilite );
+
+/**
+ * @brief Renvoie la mémoire occupée par une relation d'accessibilité, en 
+ * octets.
+ */
+size_t memoire_accessibilite( const Accessibilite * accessibilite );
+
+/**
+ * @brief Teste si un état en atteint un autre, avec un seul test de bit 
+ * (après la recherche des deux états).
+ *
+ * @param accessibilite Une relation d'accessibilité.
+ * @param origine Un état.
+ * @param fin Un état.
+ * @return true si un chemin, éventuellement vide, mène de 'origine' à 
+ *         'fin'. Si l'un des deux n'est pas un état de l'automate, la 
+ *         fonction renvoie true si et seulement si origine == fin.
+ */
+bool peut_atteindre( const Accessibilite * accessibilite, int origine, int fin );
+
+#endif
@@ -22,7 +22,12 @@
 #include "table.h"
 #include "ensemble.h"
 #include "outils.h"
-#include "fifo.h"
+#include "simulation.h"
+#include "determinisation.h"
+#include "produit.h"
+#include "graphe.h"
+#include "composantes.h"
+#include "vecteurs.h"
 
 #include <search.h>
 #include <stdio.h>
@@ -32,7 +37,6 @@
 
 #include <assert.h>
 
-#include <math.h>
 
 void action_get_max_etat( const intptr_t element, void* data ){
 	int * max = (int*) data;
@@ -105,14 +109,30 @@ Automate * creer_automate(){
 		( intptr_t (*)( const intptr_t ) ) copier_cle,
 		( void(*)(intptr_t) ) supprimer_cle
 	);
+	automate->antecedents = NULL;
 	automate->initiaux = creer_ensemble( NULL, NULL, NULL );
 	automate->finaux = creer_ensemble( NULL, NULL, NULL );
 	automate->vide = creer_ensemble( NULL, NULL, NULL ); 
+	automate->observation = NULL;
+	automate->source = NULL;
 	return automate;
 }
 
+void observer_automate( 
+	Automate * automate, Observateur_automate observateur, void * data 
+){
+	xfree( automate->observation );
+	automate->observation = NULL;
+	if( observateur ){
+		automate->observation = xmalloc( sizeof(Observation_automate) );
+		automate->observation->observateur = observateur;
+		automate->observation->data = data;
+	}
+}
+
 void liberer_automate( Automate * automate ){
 	assert( automate );
+	assert( ! automate->source ); // Les vues sont libérées par liberer_vue_miroir().
 	liberer_ensemble( automate->vide );
 	liberer_ensemble( automate->finaux );
 	liberer_ensemble( automate->initiaux );
@@ -120,8 +140,15 @@ void liberer_automate( Automate * automate ){
 		automate->transitions, ( void(*)(intptr_t) ) liberer_ensemble
 	);
 	liberer_table( automate->transitions );
+	if( automate->antecedents ){
+		pour_toute_valeur_table(
+			automate->antecedents, ( void(*)(intptr_t) ) liberer_ensemble
+		);
+		liberer_table( automate->antecedents );
+	}
 	liberer_ensemble( automate->alphabet );
 	liberer_ensemble( automate->etats );
+	xfree( automate->observation );
 	xfree(automate);
 }
 
@@ -149,30 +176,64 @@ void ajouter_lettre( Automate * automate, char lettre ){
 	ajouter_element( automate->alphabet, lettre );
 }
 
-void ajouter_transition(
-	Automate * automate, int origine, char lettre, int fin
+/*
+ * Ajoute 'element' à l'ensemble associé à (cle, lettre) dans une table de 
+ * transitions ; renvoie 1 s'il n'y était pas.
+ */
+int ajouter_dans_table_transitions( 
+	Table * table, int cle_etat, char lettre, int element 
 ){
-	ajouter_etat( automate, origine );
-	ajouter_etat( automate, fin );
-	ajouter_lettre( automate, lettre );
-
 	Cle cle;
-	initialiser_cle( &cle, origine, lettre );
-	Table_iterateur it = trouver_table( automate->transitions, (intptr_t) &cle );
+	initialiser_cle( &cle, cle_etat, lettre );
+	Table_iterateur it = trouver_table( table, (intptr_t) &cle );
 	Ensemble * ens;
 	if( iterateur_est_vide( it ) ){
 		ens = creer_ensemble( NULL, NULL, NULL );
-		add_table( automate->transitions, (intptr_t) &cle, (intptr_t) ens );
+		add_table( table, (intptr_t) &cle, (intptr_t) ens );
 	}else{
 		ens = (Ensemble*) get_valeur( it );
+		if( est_dans_l_ensemble( ens, element ) ) return 0;
+	}
+	ajouter_element( ens, element );
+	return 1;
+}
+
+void ajouter_transition(
+	Automate * automate, int origine, char lettre, int fin
+){
+	ajouter_etat( automate, origine );
+	ajouter_etat( automate, fin );
+	ajouter_lettre( automate, lettre );
+
+	if( ! ajouter_dans_table_transitions( automate->transitions, origine, lettre, fin ) ){
+		return;
+	}
+	if( automate->antecedents ){
+		ajouter_dans_table_transitions( automate->antecedents, fin, lettre, origine );
+	}
+	if( automate->observation ){
+		automate->observation->observateur(
+			automate->observation->data, MODIFICATION_TRANSITION, 
+			origine, lettre, fin
+		);
 	}
-	ajouter_element( ens, fin );
 }
 
 void ajouter_etat_final(
 	Automate * automate, int etat_final
 ){
 	ajouter_etat( automate, etat_final );
+	if( 
+		automate->observation 
+		&& ! est_dans_l_ensemble( automate->finaux, etat_final ) 
+	){
+		ajouter_element( automate->finaux, etat_final );
+		automate->observation->observateur(
+			automate->observation->data, MODIFICATION_ETAT_FINAL, 
+			etat_final, '\0', etat_final
+		);
+		return;
+	}
 	ajouter_element( automate->finaux, etat_final );
 }
 
@@ -183,6 +244,66 @@ void ajouter_etat_initial(
 	ajouter_element( automate->initiaux, etat_initial );
 }
 
+/*
+ * Retire 'element' de l'ensemble associé à (cle, lettre) dans une table de 
+ * transitions, et l'ensemble lui-même s'il devient vide ; renvoie 1 si 
+ * l'élément y était.
+ */
+int retirer_de_table_transitions( 
+	Table * table, int cle_etat, char lettre, int element 
+){
+	Cle cle;
+	initialiser_cle( &cle, cle_etat, lettre );
+	Table_iterateur it = trouver_table( table, (intptr_t) &cle );
+	if( iterateur_est_vide( it ) ) return 0;
+	Ensemble * ens = (Ensemble*) get_valeur( it );
+	if( ! est_dans_l_ensemble( ens, element ) ) return 0;
+	retirer_element( ens, element );
+	if( taille_ensemble( ens ) == 0 ){
+		delete_table( table, (intptr_t) &cle );
+		liberer_ensemble( ens );
+	}
+	return 1;
+}
+
+void retirer_transition(
+	Automate * automate, int origine, char lettre, int fin
+){
+	if( ! retirer_de_table_transitions( automate->transitions, origine, lettre, fin ) ){
+		return;
+	}
+	if( automate->antecedents ){
+		retirer_de_table_transitions( automate->antecedents, fin, lettre, origine );
+	}
+	if( automate->observation ){
+		automate->observation->observateur(
+			automate->observation->data, MODIFICATION_RETRAIT_TRANSITION, 
+			origine, lettre, fin
+		);
+	}
+}
+
+void retirer_etat_initial( Automate * automate, int etat ){
+	retirer_element( automate->initiaux, etat );
+}
+
+void retirer_etat_final( Automate * automate, int etat ){
+	if( ! est_dans_l_ensemble( automate->finaux, etat ) ) return;
+	retirer_element( automate->finaux, etat );
+	if( automate->observation ){
+		automate->observation->observateur(
+			automate->observation->data, MODIFICATION_RETRAIT_ETAT_FINAL, 
+			etat, '\0', etat
+		);
+	}
+}
+
+void retirer_etat( Automate * automate, int etat ){
+	retirer_etat_final( automate, etat );
+	retirer_element( automate->initiaux, etat );
+	retirer_element( automate->etats, etat );
+}
+
 const Ensemble * voisins( const Automate* automate, int origine, char lettre ){
 	Cle cle;
 	initialiser_cle( &cle, origine, lettre );
@@ -194,6 +315,37 @@ const Ensemble * voisins( const Automate* automate, int origine, char lettre ){
 	}
 }
 
+void action_indexer_antecedent( int origine, char lettre, int fin, void* data ){
+	ajouter_dans_table_transitions( (Table*) data, fin, lettre, origine );
+}
+
+Table * creer_table_antecedents( const Automate * automate ){
+	Table * table = creer_table(
+		( int(*)(const intptr_t, const intptr_t) ) comparer_cle , 
+		( intptr_t (*)( const intptr_t ) ) copier_cle,
+		( void(*)(intptr_t) ) supprimer_cle
+	);
+	pour_toute_transition( automate, action_indexer_antecedent, table );
+	return table;
+}
+
+void indexer_antecedents( Automate * automate ){
+	if( automate->antecedents ) return;
+	automate->antecedents = creer_table_antecedents( automate );
+}
+
+const Ensemble * antecedents( const Automate* automate, int fin, char lettre ){
+	assert( automate->antecedents );
+	Cle cle;
+	initialiser_cle( &cle, fin, lettre );
+	Table_iterateur it = trouver_table( automate->antecedents, (intptr_t) &cle );
+	if( ! iterateur_est_vide( it ) ){
+		return (Ensemble*) get_valeur( it );
+	}else{
+		return automate->vide;
+	}
+}
+
 Ensemble * delta(
 	const Automate* automate, const Ensemble * etats_courants, char lettre
 ){
@@ -310,186 +462,13 @@ Automate* copier_automate( const Automate* automate ){
 	return res;
 }
 
-/*
- *                         x = 0
- *                          |
- *                          V
- * 
- * 283 237 195 157 123  93  67  91 119 151 187 227 271 
- * 238 196 158 124  94  68  46  66  90 118 150 186 226 
- * 197 159 125  95  69  47  29  45  65  89 117 149 185 
- * 160 126  96  70  48  30  16  28  44  64  88 116 148 
- * 127  97  71  49  31  17   7  15  27  43  63  87 115 
- *  98  72  50  32  18   8   2   6  14  26  42  62  86 
- *  73  51  33  19   9   3   0   1   5  13  25  41  61  <- y = 0
- * 100  74  52  34  20  10   4  12  24  40  60  84 112 
- * 131 101  75  53  35  21  11  23  39  59  83 111 143 
- * 166 132 102  76  54  36  22  38  58  82 110 142 178 
- * 205 167 133 103  77  55  37  57  81 109 141 177 217 
- * 248 206 168 134 104  78  56  80 108 140 176 216 260 
- * 295 249 207 169 135 105  79 107 139 175 215 259 307
- * 
- */
-int couple_to_int( int q1, int q2 ){
-	if(q1==0 && q2==0) return 0;
-	int sum = abs(q1) + abs(q2);
-	int prev = 2*sum*(sum-1);
-	if( q1 > 0 && q2 >= 0 ) return prev + 1 + q2;
-	if( q1 <= 0 && q2 > 0 ) return prev + sum+1 + (-q1);
-	if( q1 < 0 && q2 <= 0 ) return prev + 2*sum+ 1 + (-q2);
-	return prev + 3*sum+ 1 + q1; //cas q1>=0 && q2<0 
-}
-
-void int_to_couple( int entree, int * q1, int * q2 ){
-	if( entree == 0 ){
-		*q1 = 0;
-		*q2 = 0;
-		return;
-	}
-	entree -= 1;
-	int sum = (int) floor( ( 1+ sqrt( 1 + 2.0*entree ) )/2.0 );
-	int couche = entree - 2*sum*(sum-1);
-	int r = couche % sum;
-	int s = sum-r;
-	switch( couche/sum ){ 
-		case 0:
-			*q2=r;
-			*q1=s;
-			break;
-		case 1:
-			*q1=-r;
-			*q2=s;
-			break;
-		case 2:
-			*q2 = -r;
-			*q1=-s;
-			break;
-		case 3:
-			*q1 = r;
-			*q2=-s;
-			break;
-		default:
-			ERREUR("Impossible !");
-	}
-}
-
 Automate * creer_intersection_des_automates(
 	const Automate * automate_1, const Automate * automate_2
 ){
-	Automate * res = creer_automate();
-
-	// On engendre tous les couples et on les ajoute dans l'automate
-	Ensemble_iterateur it_etat_1;
-	Ensemble_iterateur it_etat_2;
-	Ensemble_iterateur it_lettre;
-	for(
-		it_etat_1 = premier_iterateur_ensemble( get_etats( automate_1 ) );
-		! iterateur_ensemble_est_vide( it_etat_1 );
-		it_etat_1 = iterateur_suivant_ensemble( it_etat_1 )
-	){
-		int q1 = get_element( it_etat_1 );
-		for(
-			it_etat_2 = premier_iterateur_ensemble( get_etats( automate_2 ) );
-			! iterateur_ensemble_est_vide( it_etat_2 );
-			it_etat_2 = iterateur_suivant_ensemble( it_etat_2 )
-		){
-			int q2 = get_element( it_etat_2 );
-			ajouter_etat( res, couple_to_int( q1, q2 ) );
-		}
-	}
-
-	// On engendre tous les couples d'états initiaux :
-	for(
-		it_etat_1 = premier_iterateur_ensemble( get_initiaux( automate_1 ) );
-		! iterateur_ensemble_est_vide( it_etat_1 );
-		it_etat_1 = iterateur_suivant_ensemble( it_etat_1 )
-	){
-		int q1 = get_element( it_etat_1 );
-		for(
-			it_etat_2 = premier_iterateur_ensemble( get_initiaux( automate_2 ) );
-			! iterateur_ensemble_est_vide( it_etat_2 );
-			it_etat_2 = iterateur_suivant_ensemble( it_etat_2 )
-		){
-			int q2 = get_element( it_etat_2 );
-			ajouter_etat_initial( 
-				res, couple_to_int( q1, q2 )
-			);
-		}
-	}
-
-	// On engendre tous les couples d'états finaux :
-	for(
-		it_etat_1 = premier_iterateur_ensemble( get_finaux( automate_1 ) );
-		! iterateur_ensemble_est_vide( it_etat_1 );
-		it_etat_1 = iterateur_suivant_ensemble( it_etat_1 )
-	){
-		int q1 = get_element( it_etat_1 );
-		for(
-			it_etat_2 = premier_iterateur_ensemble( get_finaux( automate_2 ) );
-			! iterateur_ensemble_est_vide( it_etat_2 );
-			it_etat_2 = iterateur_suivant_ensemble( it_etat_2 )
-		){
-			int q2 = get_element( it_etat_2 );
-			ajouter_etat_final( 
-				res, couple_to_int( q1, q2 )
-			);			
-		}
-	}
-
-	// On engendre l'alphabet :
-	for(
-		it_lettre = premier_iterateur_ensemble( get_alphabet( automate_1 ) );
-		! iterateur_ensemble_est_vide( it_lettre );
-		it_lettre = iterateur_suivant_ensemble( it_lettre )
-	){
-		char lettre = get_element( it_lettre );
-		ajouter_lettre( res, lettre );
-	}
-	for(
-		it_lettre = premier_iterateur_ensemble( get_alphabet( automate_2 ) );
-		! iterateur_ensemble_est_vide( it_lettre );
-		it_lettre = iterateur_suivant_ensemble( it_lettre )
-	){
-		char lettre = get_element( it_lettre );
-		ajouter_lettre( res, lettre );
-	}
-
-	// On engendre les transitions :
-	Ensemble_iterateur it_etat;
-	for(
-		it_etat = premier_iterateur_ensemble( get_etats( res ) );
-		! iterateur_ensemble_est_vide( it_etat );
-		it_etat = iterateur_suivant_ensemble( it_etat )
-	){
-		int q = get_element( it_etat );
-		int o1 , o2, e1, e2;
-		int_to_couple( q, &o1, &o2 );
-		for(
-			it_lettre = premier_iterateur_ensemble( get_alphabet( res ) );
-			! iterateur_ensemble_est_vide( it_lettre );
-			it_lettre = iterateur_suivant_ensemble( it_lettre )
-		){
-			char lettre = get_element( it_lettre );
-			const Ensemble * v1 = voisins( automate_1, o1, lettre );
-			const Ensemble * v2 = voisins( automate_2, o2, lettre );
-			for(
-				it_etat_1 = premier_iterateur_ensemble( v1 );
-				! iterateur_ensemble_est_vide( it_etat_1 );
-				it_etat_1 = iterateur_suivant_ensemble( it_etat_1 )
-			){
-				e1 = get_element( it_etat_1 );
-				for(
-					it_etat_2 = premier_iterateur_ensemble( v2 );
-					! iterateur_ensemble_est_vide( it_etat_2 );
-					it_etat_2 = iterateur_suivant_ensemble( it_etat_2 )
-				){
-					e2 = get_element( it_etat_2 );
-					ajouter_transition( res, q, lettre, couple_to_int(e1,e2) );
-				}
-			}
-		}
-	}
-
+	const Automate * automates[2] = { emonder( automate_1 ), emonder( automate_2 ) };
+	Automate * res = creer_produit_des_automates( automates, 2, NULL, NULL, NULL );
+	liberer_automate( (Automate *) automates[0] );
+	liberer_automate( (Automate *) automates[1] );
 	return res;
 }
 
@@ -520,122 +499,134 @@ int etat_maximal( const Automate * automate ){
 	return max;
 }
 
-Ensemble* etats_accessibles( const Automate * automate, int etat ){
+/*
+ * Renvoie l'ensemble des états atteints par un parcours en largeur de 
+ * l'index d'un automate depuis des indices d'états.
+ */
+Ensemble * parcourir_depuis( const Graphe * graphe, const int * sources, int nb_sources ){
+	uint64_t * vus = xmalloc( ( NB_MOTS_BITS( graphe->nb_etats ) + 1 ) * sizeof(uint64_t) );
+	memset( vus, 0, ( NB_MOTS_BITS( graphe->nb_etats ) + 1 ) * sizeof(uint64_t) );
+	int * ordre = xmalloc( ( graphe->nb_etats + 1 ) * sizeof(int) );
+	int nb = parcourir_graphe( graphe, sources, nb_sources, 0, vus, ordre );
 	Ensemble * resultat = creer_ensemble( NULL, NULL, NULL );
-	Ensemble * courants = creer_ensemble( NULL, NULL, NULL );
-	ajouter_element( resultat, etat );
-	ajouter_elements( courants, resultat );
-
-	int n = taille_ensemble( get_etats( automate ) );
 	int i;
-
-	Ensemble* tmp;
-	Ensemble* next;
-
-	for( i=0; i< n-1; i++ ){
-
-		next = creer_ensemble( NULL, NULL, NULL );
-
-		Ensemble_iterateur it;
-		for( 
-			it = premier_iterateur_ensemble( get_alphabet( automate ) );
-			! iterateur_ensemble_est_vide( it );
-			it = iterateur_suivant_ensemble( it )
-		){
-			tmp = delta( automate, courants, get_element(it) );
-			ajouter_elements( next, tmp );
-			liberer_ensemble( tmp );
-		}
-
-		ajouter_elements( resultat, next );
-		liberer_ensemble( courants );
-		courants = next;
+	for( i=0; i<nb; i++ ){
+		ajouter_element( resultat, graphe->etats[ ordre[i] ] );
 	}
-	
-	liberer_ensemble( courants );
+	xfree( vus );
+	xfree( ordre );
+	return resultat;
+}
 
+Ensemble* etats_accessibles( const Automate * automate, int etat ){
+	Graphe * graphe = creer_graphe( automate );
+	int source = indice_etat_graphe( graphe, etat );
+	Ensemble * resultat;
+	if( source >= 0 ){
+		resultat = parcourir_depuis( graphe, &source, 1 );
+	}else{
+		resultat = creer_ensemble( NULL, NULL, NULL );
+		ajouter_element( resultat, etat );
+	}
+	liberer_graphe( graphe );
 	return resultat;
 }
 
 Ensemble* accessibles( const Automate * automate ){
-	Ensemble_iterateur it1;
-	Ensemble * access = creer_ensemble( NULL, NULL, NULL );
-	for(
-		it1 = premier_iterateur_ensemble( get_initiaux( automate ) );
-		! iterateur_ensemble_est_vide( it1 );
-		it1 = iterateur_suivant_ensemble( it1 )
-	){
-		Ensemble * ens = etats_accessibles( automate, get_element(it1) );
-		ajouter_elements( access, ens );
-		liberer_ensemble( ens );
-	}
+	Graphe * graphe = creer_graphe( automate );
+	Ensemble * access = parcourir_depuis( 
+		graphe, graphe->initiaux, graphe->nb_initiaux 
+	);
+	liberer_graphe( graphe );
 	return access;
 }
 
 Automate *automate_accessible( const Automate * automate ){
 	Automate * res = creer_automate();
-	Ensemble_iterateur it1;
-
-	Ensemble * access = accessibles( automate );
+	Graphe * graphe = creer_graphe( automate );
+	uint64_t * vus = xmalloc( ( NB_MOTS_BITS( graphe->nb_etats ) + 1 ) * sizeof(uint64_t) );
+	memset( vus, 0, ( NB_MOTS_BITS( graphe->nb_etats ) + 1 ) * sizeof(uint64_t) );
+	int * ordre = xmalloc( ( graphe->nb_etats + 1 ) * sizeof(int) );
+	int nb = parcourir_graphe( 
+		graphe, graphe->initiaux, graphe->nb_initiaux, 0, vus, ordre 
+	);
+	int i, l, k;
 
-	// On ajoute les états de l'automate
-	for(
-		it1 = premier_iterateur_ensemble( access );
-		! iterateur_ensemble_est_vide( it1 );
-		it1 = iterateur_suivant_ensemble( it1 )
-	){
-		ajouter_etat( res, get_element( it1 ) );
+	// On ajoute les états, les états initiaux et les états finaux
+	for( i=0; i<nb; i++ ){
+		ajouter_etat( res, graphe->etats[ ordre[i] ] );
 	}
-	// On ajoute les états initiaux
-	for(
-		it1 = premier_iterateur_ensemble( get_initiaux( automate ) );
-		! iterateur_ensemble_est_vide( it1 );
-		it1 = iterateur_suivant_ensemble( it1 )
-	){
-		ajouter_etat_initial( res, get_element( it1 ) );
+	for( i=0; i<graphe->nb_initiaux; i++ ){
+		ajouter_etat_initial( res, graphe->etats[ graphe->initiaux[i] ] );
 	}
-	// On ajoute les états finaux
-	for(
-		it1 = premier_iterateur_ensemble( access );
-		! iterateur_ensemble_est_vide( it1 );
-		it1 = iterateur_suivant_ensemble( it1 )
-	){
-		int etat = get_element( it1 );
-		if( est_un_etat_final_de_l_automate( automate, etat ) ){
-			ajouter_etat_final( res, etat );
+	for( i=0; i<nb; i++ ){
+		if( graphe->final[ ordre[i] ] ){
+			ajouter_etat_final( res, graphe->etats[ ordre[i] ] );
 		}
 	}
 	// On ajoute les lettres
-	for(
-		it1 = premier_iterateur_ensemble( get_alphabet( automate ) );
-		! iterateur_ensemble_est_vide( it1 );
-		it1 = iterateur_suivant_ensemble( it1 )
-	){
-		ajouter_lettre( res, (char) get_element( it1 ) );
+	for( l=0; l<graphe->nb_lettres; l++ ){
+		ajouter_lettre( res, graphe->lettres[l] );
 	}
-	// On ajoute les transitions
-	Table_iterateur it2;
-	for(
-		it2 = premier_iterateur_table( automate->transitions );
-		! iterateur_est_vide( it2 );
-		it2 = iterateur_suivant_table( it2 )
-	){
-		Cle * cle = (Cle*) get_cle( it2 );
-		int origine = cle->origine; 
-		char lettre = cle->lettre;
-		if( est_dans_l_ensemble( access, origine ) ){ 
-			Ensemble * fins = (Ensemble*) get_valeur( it2 );
-			for(
-				it1 = premier_iterateur_ensemble( fins );
-				! iterateur_ensemble_est_vide( it1 );
-				it1 = iterateur_suivant_ensemble( it1 )
-			){
-				int fin = get_element( it1 );
-				ajouter_transition( res, origine, lettre, fin );
+	// On ajoute les transitions des états accessibles
+	for( i=0; i<nb; i++ ){
+		int origine = ordre[i];
+		for( l=0; l<graphe->nb_lettres; l++ ){
+			int cellule = origine * graphe->nb_lettres + l;
+			for( k=graphe->debut[cellule]; k<graphe->debut[cellule+1]; k++ ){
+				ajouter_transition( 
+					res, graphe->etats[origine], graphe->lettres[l], 
+					graphe->etats[ graphe->fins[k] ] 
+				);
 			}
 		}
-	};
-	liberer_ensemble( access );
+	}
+	xfree( vus );
+	xfree( ordre );
+	liberer_graphe( graphe );
+	return res;
+}
+
+Automate * emonder( const Automate * automate ){
+	Graphe * graphe = creer_graphe( automate );
+	char * utile = etats_utiles_graphe( graphe );
+	int i, l, k;
+
+	// Numéros des états utiles, dans l'ordre croissant.
+	int * numero = xmalloc( ( graphe->nb_etats + 1 ) * sizeof(int) );
+	int nb_utiles = 0;
+	for( i=0; i<graphe->nb_etats; i++ ){
+		numero[i] = utile[i] ? nb_utiles++ : -1;
+	}
+
+	Automate * res = creer_automate();
+	for( l=0; l<graphe->nb_lettres; l++ ){
+		ajouter_lettre( res, graphe->lettres[l] );
+	}
+	for( i=0; i<graphe->nb_etats; i++ ){
+		if( numero[i] < 0 ) continue;
+		ajouter_etat( res, numero[i] );
+		if( graphe->final[i] ) ajouter_etat_final( res, numero[i] );
+		for( l=0; l<graphe->nb_lettres; l++ ){
+			int cellule = i * graphe->nb_lettres + l;
+			for( k=graphe->debut[cellule]; k<graphe->debut[cellule+1]; k++ ){
+				if( numero[ graphe->fins[k] ] >= 0 ){
+					ajouter_transition( 
+						res, numero[i], graphe->lettres[l], numero[ graphe->fins[k] ] 
+					);
+				}
+			}
+		}
+	}
+	for( i=0; i<graphe->nb_initiaux; i++ ){
+		if( numero[ graphe->initiaux[i] ] >= 0 ){
+			ajouter_etat_initial( res, numero[ graphe->initiaux[i] ] );
+		}
+	}
+
+	xfree( utile );
+	xfree( numero );
+	liberer_graphe( graphe );
 	return res;
 }
 
@@ -657,6 +648,26 @@ void ajouter_etat_initial_bis(intptr_t element, void *data) {
 	ajouter_etat_initial(automate, element);
 }
 
+const Automate * vue_miroir( Automate * automate ){
+	indexer_antecedents( automate );
+	Automate * vue = xmalloc( sizeof(Automate) );
+	vue->vide = automate->vide;
+	vue->etats = automate->etats;
+	vue->alphabet = automate->alphabet;
+	vue->transitions = automate->antecedents;
+	vue->antecedents = automate->transitions;
+	vue->initiaux = automate->finaux;
+	vue->finaux = automate->initiaux;
+	vue->observation = NULL;
+	vue->source = automate;
+	return vue;
+}
+
+void liberer_vue_miroir( const Automate * vue ){
+	assert( vue->source );
+	xfree( (Automate *) vue );
+}
+
 Automate *miroir( const Automate * automate){
 	Automate *automate_miroir = creer_automate();
 
@@ -772,106 +783,232 @@ int le_mot_est_reconnu( const Automate* automate, const char* mot ){
 	return result;
 }
 
-int ajouter_ensemble( 
-	const Ensemble* ens,
-	Table* ensemble_to_id, Table* id_to_ensemble, Fifo* f, 
-	Automate * aut, int next_id
+/*
+ * Estimation de la mémoire occupée par une transition de l'automate 
+ * résultat (noeud d'AVL et part de la table des transitions).
+ */
+#define MEMOIRE_ESTIMEE_TRANSITION 64
+
+Statut_budget creer_automate_deterministe_budget(
+	const Automate* automate, Budget * budget, Automate ** resultat
 ){
-	
-	Table_iterateur it = trouver_table( ensemble_to_id, (intptr_t) ens );
-	if( iterateur_est_vide( it ) ){
-		add_table( ensemble_to_id, (intptr_t) ens, next_id );
-		add_table( id_to_ensemble, next_id, (intptr_t) ens );
-		ajouter_fifo( f, (intptr_t) ens );
-		ajouter_etat( aut, next_id );
-		return next_id+1;
+	*resultat = NULL;
+	Statut_budget statut = verifier_budget( budget, 0, 0 );
+	if( statut != BUDGET_RESPECTE ) return statut;
+
+	Automate * res = creer_automate();
+	Determinisation * d = creer_determinisation( automate );
+	const Graphe * g = graphe_determinisation( d );
+	size_t nb_transitions = 0;
+
+	// Les parties sont explorées avec une pile, dans l'ordre de leur 
+	// découverte ; elles sont numérotées dans ce même ordre.
+	int capacite = 16;
+	int * pile = xmalloc( capacite * sizeof(int) );
+	int sommet = 0;
+
+	ajouter_etat_initial( res, 0 );
+	pile[sommet++] = 0;
+	while( sommet > 0 ){
+		statut = verifier_budget(
+			budget, nombre_etats_determinisation( d ),
+			memoire_determinisation( d ) 
+			+ nb_transitions * MEMOIRE_ESTIMEE_TRANSITION
+		);
+		if( statut != BUDGET_RESPECTE ) break;
+
+		int id_e = pile[--sommet];
+		int l;
+		for( l=0; l<g->nb_lettres; l++ ){
+			int nb_etats = nombre_etats_determinisation( d );
+			int id = successeur_determinisation( d, id_e, l );
+			if( id == nb_etats ){
+				ajouter_etat( res, id );
+				if( sommet == capacite ){
+					capacite *= 2;
+					pile = xrealloc( pile, capacite * sizeof(int) );
+				}
+				pile[sommet++] = id;
+			}
+			ajouter_transition( res, id_e, g->lettres[l], id );
+		}
+		nb_transitions += g->nb_lettres;
+		if( est_final_determinisation( d, id_e ) ){
+			ajouter_etat_final( res, id_e );
+		}
+	}
+
+	xfree( pile );
+	liberer_determinisation( d );
+	if( statut != BUDGET_RESPECTE ){
+		liberer_automate( res );
 	}else{
-		return next_id;
+		*resultat = res;
 	}
+	return statut;
 }
 
 Automate * creer_automate_deterministe( const Automate* automate ){
-	Automate * res = creer_automate();
-
-	Fifo* f = creer_fifo();
-	Table* ensemble_to_id = creer_table(
-		( int(*)(const intptr_t, const intptr_t) ) comparer_ensemble, 
-		( intptr_t (*)( const intptr_t ) ) copier_ensemble,
-		( void(*)(intptr_t) ) liberer_ensemble
-	);
-	Table* id_to_ensemble = creer_table( NULL, NULL, NULL );
-	
-	int next_id = ajouter_ensemble(
-		copier_ensemble( get_initiaux( automate ) ), 
-		ensemble_to_id, id_to_ensemble, f, res, 0
-	);
-	ajouter_etat_initial( res, 0 );
+	Automate * res;
+	creer_automate_deterministe_budget( automate, NULL, &res );
+	return res;
+}
 
-	while( ! est_vide( f ) ){
-		Ensemble* e = (Ensemble*) retirer_fifo( f );
-		int id_e = get_valeur( trouver_table( ensemble_to_id, (intptr_t) e ) );
+Automate * creer_automate_deterministe_avec_options(
+	const Automate* automate, int options
+){
+	Automate * res;
+	if( options & OPTION_REDUCTION_SIMULATION ){
+		Automate * reduit = reduire_par_simulation( automate );
+		res = creer_automate_deterministe_avec_options( 
+			reduit, options & ~OPTION_REDUCTION_SIMULATION 
+		);
+		liberer_automate( reduit );
+	}else if( options & OPTION_EMONDAGE ){
+		Automate * emonde = emonder( automate );
+		res = creer_automate_deterministe( emonde );
+		liberer_automate( emonde );
+	}else{
+		res = creer_automate_deterministe( automate );
+	}
+	return res;
+}
 
-		Ensemble_iterateur it_lettre;
-		for(
-			it_lettre = premier_iterateur_ensemble( get_alphabet( automate ) );
-			! iterateur_ensemble_est_vide( it_lettre );
-			it_lettre = iterateur_suivant_ensemble( it_lettre )
-		){
-			char lettre = (char) get_element( it_lettre );
-			Ensemble * img = delta( automate, e, lettre );
-			int id = ajouter_ensemble(
-				img, ensemble_to_id, id_to_ensemble, f, res, next_id
-			);
-			ajouter_transition(
-				res, id_e, lettre, get_valeur(
-					trouver_table( ensemble_to_id, (intptr_t) img ) 
-				)
-			);
-			if( next_id == id ){
-				liberer_ensemble(img);
-			}else{
-				next_id = id;
+Automate * creer_automate_minimal_avec_options(
+	const Automate* automate, int options
+){
+	if( options & OPTION_REDUCTION_SIMULATION ){
+		Automate * reduit = reduire_par_simulation( automate );
+		Automate * res = creer_automate_minimal( reduit );
+		liberer_automate( reduit );
+		return res;
+	}
+	return creer_automate_minimal( automate );
+}
+
+Automate * minimiser_automate_acyclique( const Automate * automate ){
+	Graphe * graphe = creer_graphe( automate );
+	Composantes * composantes = creer_composantes( graphe );
+	char * utile = etats_utiles_graphe( graphe );
+	int nb_lettres = graphe->nb_lettres;
+	int i, l, m;
+
+	// Deux états utiles sont équivalents si et seulement s'ils ont la même
+	// signature (finalité, classes des successeurs), les successeurs étant 
+	// traités avant grâce à l'ordre topologique. Les états inutiles forment 
+	// une seule classe, codée par 0 dans les signatures.
+	int * classe = xmalloc( ( graphe->nb_etats + 1 ) * sizeof(int) );
+	uint64_t * signature = xmalloc( ( nb_lettres + 1 ) * sizeof(uint64_t) );
+	Table_vecteurs * classes = creer_table_vecteurs();
+	for( m=graphe->nb_etats-1; m>=0; m-- ){
+		int v = composantes->membres[m];
+		classe[v] = -1;
+		if( ! utile[v] ) continue;
+		signature[0] = graphe->final[v];
+		for( l=0; l<nb_lettres; l++ ){
+			int cellule = v * nb_lettres + l;
+			assert( graphe->debut[cellule+1] - graphe->debut[cellule] <= 1 );
+			signature[l+1] = 0;
+			if( graphe->debut[cellule] < graphe->debut[cellule+1] ){
+				signature[l+1] = classe[ graphe->fins[ graphe->debut[cellule] ] ] + 1;
 			}
 		}
+		classe[v] = interner_vecteur( classes, signature, nb_lettres + 1, NULL );
+	}
 
-		Ensemble_iterateur it_e;
-		for(
-			it_e = premier_iterateur_ensemble( e );
-			! iterateur_ensemble_est_vide( it_e );
-			it_e = iterateur_suivant_ensemble( it_e )
-		){
-			int elmt = get_element( it_e );
-			if(  est_un_etat_final_de_l_automate( automate, elmt ) ){
-				ajouter_etat_final( res, id_e );	
-				break;
+	// Les classes sont numérotées dans l'ordre d'un parcours en largeur depuis
+	// la classe initiale ; la classe des états inutiles est le puits.
+	int puits = taille_table_vecteurs( classes );
+	int * numero = xmalloc( ( puits + 1 ) * sizeof(int) );
+	int * file = xmalloc( ( puits + 1 ) * sizeof(int) );
+	for( i=0; i<=puits; i++ ) numero[i] = -1;
+	int initiale = puits;
+	if( graphe->nb_initiaux > 0 && classe[ graphe->initiaux[0] ] >= 0 ){
+		initiale = classe[ graphe->initiaux[0] ];
+	}
+	int nb_numeros = 0;
+	int tete = 0;
+	numero[ initiale ] = nb_numeros++;
+	file[ 0 ] = initiale;
+
+	Automate * res = creer_automate();
+	for( l=0; l<nb_lettres; l++ ){
+		ajouter_lettre( res, graphe->lettres[l] );
+	}
+	ajouter_etat_initial( res, 0 );
+	while( tete < nb_numeros ){
+		int c = file[ tete++ ];
+		int nb_mots;
+		const uint64_t * sig = ( c == puits ) ? NULL : get_vecteur( classes, c, &nb_mots );
+		ajouter_etat( res, numero[c] );
+		if( sig && sig[0] ) ajouter_etat_final( res, numero[c] );
+		for( l=0; l<nb_lettres; l++ ){
+			int d = ( sig && sig[l+1] ) ? (int) sig[l+1] - 1 : puits;
+			if( numero[d] < 0 ){
+				numero[d] = nb_numeros;
+				file[ nb_numeros++ ] = d;
 			}
+			ajouter_transition( res, numero[c], graphe->lettres[l], numero[d] );
 		}
-		
 	}
 
-	pour_toute_valeur_table(
-		id_to_ensemble,
-		( void (*)(intptr_t valeur ) ) liberer_ensemble
-	);
-	liberer_table( id_to_ensemble );
-	liberer_table( ensemble_to_id );
-	 
-	liberer_fifo( f );
+	xfree( numero );
+	xfree( file );
+	xfree( signature );
+	xfree( classe );
+	xfree( utile );
+	liberer_table_vecteurs( classes );
+	liberer_composantes( composantes );
+	liberer_graphe( graphe );
 	return res;
 }
 
-Automate * creer_automate_minimal( const Automate* automate ){
-	Automate *etape1 = miroir(automate);
+Statut_budget creer_automate_minimal_budget(
+	const Automate* automate, Budget * budget, Automate ** resultat
+){
+	*resultat = NULL;
+	if( langage_est_fini( automate ) ){
+		// Langage fini : une seule déterminisation, puis minimisation 
+		// linéaire de l'automate acyclique.
+		Automate * emonde = emonder( automate );
+		Automate * deterministe;
+		Statut_budget statut = 
+			creer_automate_deterministe_budget( emonde, budget, &deterministe );
+		liberer_automate( emonde );
+		if( statut != BUDGET_RESPECTE ) return statut;
+		*resultat = minimiser_automate_acyclique( deterministe );
+		liberer_automate( deterministe );
+		return BUDGET_RESPECTE;
+	}
 
-	Automate *etape2 = creer_automate_deterministe(etape1);
+	// Les automates à déterminiser sont émondés : leurs états inutiles 
+	// engendreraient des parties inutiles.
+	// L'automate donné n'est pas modifiable, on ne peut pas l'indexer pour 
+	// en prendre une vue.
+	Automate *miroir1 = miroir(automate);
+	Automate *etape1 = emonder(miroir1);
+	liberer_automate(miroir1);
+
+	Automate *etape2;
+	Statut_budget statut = 
+		creer_automate_deterministe_budget(etape1, budget, &etape2);
 	liberer_automate(etape1);
+	if( statut != BUDGET_RESPECTE ) return statut;
 
-	Automate *etape3 = miroir(etape2);
+	const Automate *miroir2 = vue_miroir(etape2);
+	Automate *etape3 = emonder(miroir2);
+	liberer_vue_miroir(miroir2);
 	liberer_automate(etape2);
 
-	Automate *etape4 = creer_automate_deterministe(etape3);
+	statut = creer_automate_deterministe_budget(etape3, budget, resultat);
 	liberer_automate(etape3);
 
-	return etape4;
+	return statut;
+}
+
+Automate * creer_automate_minimal( const Automate* automate ){
+	Automate * res;
+	creer_automate_minimal_budget( automate, NULL, &res );
+	return res;
 }
 
@@ -24,6 +24,7 @@
 #define __AUTOMATE_H__
 
 #include "ensemble.h"
+#include "budget.h"
 
 /**
  * @brief Le type d'un automate.
@@ -41,12 +42,38 @@ struct Automate {
 	Ensemble * etats;
 	Ensemble * alphabet;
 	Table* transitions;
+	Table* antecedents; //!< (fin, lettre) -> origines ; NULL si l'index n'est pas maintenu.
 	Ensemble * initiaux;
 	Ensemble * finaux;
+	struct Observation_automate * observation; //!< NULL si l'automate n'est pas observé.
+	const struct Automate * source; //!< L'automate renversé par une vue (voir vue_miroir()), NULL sinon.
 };
 
 typedef struct Automate Automate;
 
+/**
+ * @brief Les modifications d'un automate signalées à son observateur.
+ */
+typedef enum {
+	MODIFICATION_TRANSITION,   //!< Une nouvelle transition (origine, lettre, fin).
+	MODIFICATION_ETAT_FINAL,   //!< Un nouvel état final (origine).
+	MODIFICATION_RETRAIT_TRANSITION, //!< Une transition retirée (origine, lettre, fin).
+	MODIFICATION_RETRAIT_ETAT_FINAL //!< Un état qui n'est plus final (origine).
+} Modification_automate;
+
+/**
+ * @brief Fonction appelée après chaque modification d'un automate observé.
+ */
+typedef void (* Observateur_automate)(
+	void * data, Modification_automate modification, 
+	int origine, char lettre, int fin
+);
+
+typedef struct Observation_automate {
+	Observateur_automate observateur;
+	void * data;
+} Observation_automate;
+
 typedef struct Cle {
 	int origine;
 	int lettre;
@@ -66,6 +93,25 @@ Automate * creer_automate();
  */ 
 void liberer_automate( Automate * automate);
 
+/**
+ * @brief Installe l'observateur d'un automate.
+ *
+ * L'observateur est appelé par ajouter_transition() et ajouter_etat_final(), 
+ * seulement si la transition ou l'état final est nouveau, ainsi que par 
+ * retirer_transition() et retirer_etat_final(), seulement si la transition 
+ * ou l'état final existait. Un automate a au 
+ * plus un observateur ; un observateur NULL supprime l'observation. Les 
+ * modifications faites directement dans les champs de la structure ne sont 
+ * pas signalées.
+ *
+ * @param automate Un automate.
+ * @param observateur La fonction à appeler, ou NULL.
+ * @param data La donnée passée à l'observateur.
+ */ 
+void observer_automate( 
+	Automate * automate, Observateur_automate observateur, void * data 
+);
+
 /**
  * @brief Ajoute un état à un automate passé en paramètre.
  *
@@ -123,6 +169,54 @@ void ajouter_etat_initial(
 	Automate * automate, int etat_initial
 );
 
+/**
+ * @brief Retire une transition de l'automate passé en paramètre.
+ *
+ * Les états et la lettre de la transition restent dans l'automate. L'index 
+ * des antécédents, s'il existe, est mis à jour.
+ *
+ * @param automate Un automate.
+ * @param origine L'origine de la transition.
+ * @param lettre La lettre de la transition.
+ * @param fin La fin de la transition.
+ */ 
+void retirer_transition(
+	Automate * automate, int origine, char lettre, int fin
+);
+
+/**
+ * @brief Retire un état de l'ensemble des états initiaux d'un automate.
+ *
+ * L'état reste un état de l'automate.
+ *
+ * @param automate Un automate.
+ * @param etat L'état.
+ */ 
+void retirer_etat_initial( Automate * automate, int etat );
+
+/**
+ * @brief Retire un état de l'ensemble des états finaux d'un automate.
+ *
+ * L'état reste un état de l'automate.
+ *
+ * @param automate Un automate.
+ * @param etat L'état.
+ */ 
+void retirer_etat_final( Automate * automate, int etat );
+
+/**
+ * @brief Retire un état d'un automate, ainsi que de ses états initiaux et 
+ * finaux.
+ *
+ * Les transitions ne sont pas parcourues : l'état ne doit plus être ni 
+ * l'origine ni la fin d'aucune transition (voir retirer_transition()). Le 
+ * retrait d'un état final est signalé comme par retirer_etat_final().
+ *
+ * @param automate Un automate.
+ * @param etat L'état à retirer.
+ */ 
+void retirer_etat( Automate * automate, int etat );
+
 /**
  * @brief Renvoie l'ensemble des états d'un automate
  *
@@ -286,6 +380,47 @@ void pour_toute_transition(
 	void* data
 );
 
+/**
+ * @brief Renvoie l'ensemble des fins des transitions d'origine et de lettre 
+ *        données.
+ *
+ * L'ensemble appartient à l'automate : il ne doit être ni modifié, ni 
+ * libéré, et n'est plus valide après une modification de l'automate.
+ *
+ * @param automate Un automate.
+ * @param origine L'origine des transitions.
+ * @param lettre La lettre des transitions.
+ * @return L'ensemble des fins (éventuellement vide).
+ */ 
+const Ensemble * voisins( const Automate* automate, int origine, char lettre );
+
+/**
+ * @brief Maintient l'index des transitions inverses d'un automate.
+ *
+ * L'index, construit à partir des transitions existantes, est ensuite mis à 
+ * jour par ajouter_transition() : antecedents() coûte alors autant que 
+ * voisins(). La fonction ne fait rien si l'index est déjà maintenu.
+ *
+ * @param automate Un automate.
+ */ 
+void indexer_antecedents( Automate * automate );
+
+/**
+ * @brief Renvoie l'ensemble des origines des transitions de fin et de lettre
+ *        données.
+ *
+ * L'index des transitions inverses doit être maintenu (voir 
+ * indexer_antecedents()). L'ensemble appartient à l'automate : il ne doit 
+ * être ni modifié, ni libéré, et n'est plus valide après une modification de
+ * l'automate.
+ *
+ * @param automate Un automate.
+ * @param fin La fin des transitions.
+ * @param lettre La lettre des transitions.
+ * @return L'ensemble des origines (éventuellement vide).
+ */ 
+const Ensemble * antecedents( const Automate* automate, int fin, char lettre );
+
 /**
  * @brief Renvoie l'état ayant le numéro le plus grand de l'automate passé en 
  *        paramètre.
@@ -348,6 +483,21 @@ Ensemble* accessibles( const Automate * automate );
  */ 
 Automate *automate_accessible( const Automate * automate );
 
+/**
+ * @brief Renvoie l'automate émondé : seuls restent les états accessibles 
+ *        depuis un état initial et co-accessibles (depuis lesquels un état 
+ *        final est accessible).
+ *
+ * Le calcul fait un parcours en avant depuis les états initiaux et un 
+ * parcours à rebours depuis les états finaux, en temps linéaire. Les états 
+ * restants sont renumérotés de 0 à n-1 dans l'ordre croissant ; l'alphabet 
+ * est conservé.
+ *
+ * @param automate Un automate.
+ * @return L'automate émondé.
+ */ 
+Automate * emonder( const Automate * automate );
+
 /**
  * @brief @todo Renvoie l'automate miroir d'un automate.
  *
@@ -359,6 +509,35 @@ Automate *automate_accessible( const Automate * automate );
  */ 
 Automate *miroir( const Automate * automate);
 
+/**
+ * @brief Renvoie une vue de l'automate miroir d'un automate, sans le copier.
+ *
+ * La vue partage les ensembles de l'automate, échange ses états initiaux et 
+ * finaux, et répond aux requêtes sur les transitions (voisins(), delta(), 
+ * delta_star(), pour_toute_transition()...) avec l'index des transitions 
+ * inverses : elle s'utilise partout où un automate constant est attendu, 
+ * par exemple avec creer_automate_deterministe(). Son alphabet est celui de
+ * l'automate, y compris les lettres sans transition.
+ *
+ * La fonction active l'index inverse de l'automate (voir 
+ * indexer_antecedents()) s'il ne l'est pas déjà : cette première activation
+ * parcourt une fois toutes les transitions, au même coût que miroir(). 
+ * Ensuite, chaque vue se construit en temps constant, et suit les 
+ * modifications de l'automate.
+ *
+ * @param automate Un automate.
+ * @return La vue, à libérer par liberer_vue_miroir() avant l'automate.
+ */ 
+const Automate * vue_miroir( Automate * automate );
+
+/**
+ * @brief Libère une vue renvoyée par vue_miroir(), sans toucher à 
+ * l'automate dont elle est la vue.
+ *
+ * @param vue Une vue.
+ */ 
+void liberer_vue_miroir( const Automate * vue );
+
 /**
  * @brief Affiche sur l'entrée standard (stdout) l'automate passé en paramètre.
  *
@@ -370,6 +549,9 @@ void print_automate( const Automate * automate );
 /**
  * @brief Crée l'intersection de deux automates.
  *
+ * Les deux automates sont d'abord émondés (voir emonder()) ; seuls les 
+ * couples d'états accessibles sont ensuite construits, numérotés à partir de 
+ * 0 (voir creer_produit_des_automates() dans produit.h).
  */
 Automate * creer_intersection_des_automates(
 	const Automate * automate_1, const Automate * automate_2
@@ -383,6 +565,47 @@ Automate * creer_intersection_des_automates(
  */ 
 Automate * creer_automate_deterministe( const Automate* automate );
 
+/**
+ * @brief Déterminise un automate avec plusieurs threads.
+ *
+ * Le résultat est identique à celui de creer_automate_deterministe(), 
+ * quels que soient le nombre de threads et leur ordonnancement.
+ *
+ * @param automate L'automate à déterminiser.
+ * @param nb_threads Le nombre de threads à utiliser (au moins 1).
+ * @return L'automate déterministe correspondant.
+ */ 
+Automate * creer_automate_deterministe_parallele(
+	const Automate* automate, int nb_threads
+);
+
+/**
+ * @brief Option des fonctions *_avec_options() : l'automate est d'abord 
+ *        réduit par reduire_par_simulation() (voir simulation.h).
+ */
+#define OPTION_REDUCTION_SIMULATION 1
+
+/**
+ * @brief Option des fonctions *_avec_options() : l'automate est émondé (voir
+ *        emonder()) avant d'être déterminisé, pour que ses états inutiles 
+ *        n'engendrent pas de parties inutiles.
+ */
+#define OPTION_EMONDAGE 2
+
+/**
+ * @brief Renvoie l'automate déterministe, en appliquant éventuellement des 
+ *        traitements préalables.
+ *
+ * Sans option, le résultat est celui de creer_automate_deterministe().
+ *
+ * @param automate L'automate à déterminiser.
+ * @param options Une combinaison (ou bit à bit) des constantes OPTION_*.
+ * @return L'automate déterministe correspondant.
+ */ 
+Automate * creer_automate_deterministe_avec_options(
+	const Automate* automate, int options
+);
+
 /**
  * @brief @todo Renvoie l'automate minimal.
  *
@@ -391,6 +614,63 @@ Automate * creer_automate_deterministe( const Automate* automate );
  */ 
 Automate * creer_automate_minimal( const Automate* automate );
 
+/**
+ * @brief Renvoie l'automate minimal, en appliquant éventuellement des 
+ *        traitements préalables.
+ *
+ * @param automate L'automate à minimiser.
+ * @param options Une combinaison (ou bit à bit) des constantes OPTION_*.
+ * @return L'automate minimal correspondant.
+ */ 
+Automate * creer_automate_minimal_avec_options(
+	const Automate* automate, int options
+);
+
+/**
+ * @brief Déterminise un automate sans dépasser un budget.
+ *
+ * Si le budget est respecté, le résultat est celui de 
+ * creer_automate_deterministe(). Sinon, la construction est abandonnée et 
+ * *resultat vaut NULL.
+ *
+ * @param automate L'automate à déterminiser.
+ * @param budget Le budget (voir budget.h), ou NULL.
+ * @param resultat Reçoit l'automate déterministe.
+ * @return BUDGET_RESPECTE, ou la raison de l'abandon.
+ */ 
+Statut_budget creer_automate_deterministe_budget(
+	const Automate* automate, Budget * budget, Automate ** resultat
+);
+
+/**
+ * @brief Minimise un automate déterministe dont le langage est fini, en 
+ * temps quasi linéaire (algorithme de Revuz).
+ *
+ * Les états de l'automate minimal (complet) sont numérotés dans l'ordre d'un
+ * parcours en largeur depuis l'état initial, qui porte le numéro 0.
+ *
+ * @param automate Un automate déterministe dont le langage est fini (voir 
+ *        langage_est_fini()).
+ * @return L'automate minimal correspondant.
+ */ 
+Automate * minimiser_automate_acyclique( const Automate * automate );
+
+/**
+ * @brief Minimise un automate sans dépasser un budget.
+ *
+ * Le budget s'applique à chacune des déterminisations intermédiaires. Si le 
+ * langage est fini, une seule déterminisation est faite, suivie de 
+ * minimiser_automate_acyclique().
+ *
+ * @param automate L'automate à minimiser.
+ * @param budget Le budget (voir budget.h), ou NULL.
+ * @param resultat Reçoit l'automate minimal, ou NULL en cas d'abandon.
+ * @return BUDGET_RESPECTE, ou la raison de l'abandon.
+ */ 
+Statut_budget creer_automate_minimal_budget(
+	const Automate* automate, Budget * budget, Automate ** resultat
+);
+
 /**
  * @brief Renvoie le nombre de transitions d'un automate.
  *
@@ -0,0 +1,82 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2014, 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Mesure le temps de creer_automate_deterministe_parallele() sur les 
+ * automates S*.a.S^k, dont le déterminisé a 2^(k+1) états, pour les 
+ * alphabets S = {a,b} et S = {a,b,c}.
+ *
+ * Usage : bench_determinisation [k]
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "automate.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+Automate * creer_automate_bench( const char * alphabet, int k ){
+	Automate * automate = creer_automate();
+	ajouter_etat_initial( automate, 0 );
+	ajouter_transition( automate, 0, 'a', 1 );
+	int i;
+	const char * c;
+	for( c = alphabet; *c; c++ ){
+		ajouter_transition( automate, 0, *c, 0 );
+		for( i=1; i<=k; i++ ) ajouter_transition( automate, i, *c, i+1 );
+	}
+	ajouter_etat_final( automate, k+1 );
+	return automate;
+}
+
+double secondes(){
+	struct timespec t;
+	clock_gettime( CLOCK_MONOTONIC, &t );
+	return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+int main( int argc, char ** argv ){
+	int k = argc > 1 ? atoi( argv[1] ) : 14;
+	const char * alphabets[] = { "ab", "abc" };
+	int a;
+	for( a=0; a<2; a++ ){
+		Automate * automate = creer_automate_bench( alphabets[a], k );
+
+		double debut = secondes();
+		Automate * res = creer_automate_deterministe( automate );
+		printf( "{%s} k=%d serie      : %.3f s\n", alphabets[a], k, secondes() - debut );
+		liberer_automate( res );
+
+		int nb_threads;
+		for( nb_threads=1; nb_threads<=8; nb_threads *= 2 ){
+			debut = secondes();
+			res = creer_automate_deterministe_parallele( automate, nb_threads );
+			printf(
+				"{%s} k=%d %d thread(s) : %.3f s\n", 
+				alphabets[a], k, nb_threads, secondes() - debut
+			);
+			liberer_automate( res );
+		}
+		liberer_automate( automate );
+	}
+	return 0;
+}
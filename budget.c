@@ -0,0 +1,72 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2014, 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "budget.h"
+
+#include <time.h>
+
+void initialiser_budget( Budget * budget ){
+	budget->max_etats = 0;
+	budget->max_octets = 0;
+	budget->echeance = 0;
+	atomic_init( &budget->annule, 0 );
+}
+
+double horloge_budget(){
+	struct timespec t;
+	clock_gettime( CLOCK_MONOTONIC, &t );
+	return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+void fixer_delai_budget( Budget * budget, double secondes ){
+	budget->echeance = horloge_budget() + secondes;
+}
+
+void annuler_budget( Budget * budget ){
+	atomic_store( &budget->annule, 1 );
+}
+
+Statut_budget verifier_budget( Budget * budget, long nb_etats, size_t octets ){
+	if( ! budget ) return BUDGET_RESPECTE;
+	if( atomic_load( &budget->annule ) ) return BUDGET_ANNULE;
+	if( budget->max_etats && nb_etats > budget->max_etats ){
+		return BUDGET_ETATS_DEPASSE;
+	}
+	if( budget->max_octets && octets > budget->max_octets ){
+		return BUDGET_MEMOIRE_DEPASSEE;
+	}
+	if( budget->echeance && horloge_budget() > budget->echeance ){
+		return BUDGET_DELAI_DEPASSE;
+	}
+	return BUDGET_RESPECTE;
+}
+
+const char * message_statut_budget( Statut_budget statut ){
+	switch( statut ){
+		case BUDGET_RESPECTE : return "budget respecté";
+		case BUDGET_ETATS_DEPASSE : return "nombre maximal d'états dépassé";
+		case BUDGET_MEMOIRE_DEPASSEE : return "mémoire maximale dépassée";
+		case BUDGET_DELAI_DEPASSE : return "délai dépassé";
+		case BUDGET_ANNULE : return "opération annulée";
+	}
+	return "statut inconnu";
+}
@@ -0,0 +1,95 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2014, 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file budget.h */ 
+
+#ifndef __BUDGET_H__
+#define __BUDGET_H__
+
+#include <stdatomic.h>
+#include <stddef.h>
+
+/**
+ * @brief Résultat d'une opération soumise à un budget.
+ */
+typedef enum {
+	BUDGET_RESPECTE = 0,       ///< L'opération s'est terminée normalement.
+	BUDGET_ETATS_DEPASSE,      ///< Trop d'états ont été construits.
+	BUDGET_MEMOIRE_DEPASSEE,   ///< Trop de mémoire a été utilisée.
+	BUDGET_DELAI_DEPASSE,      ///< La date limite est passée.
+	BUDGET_ANNULE              ///< L'opération a été annulée.
+} Statut_budget;
+
+/**
+ * @brief Limites imposées à une opération coûteuse.
+ *
+ * Une limite nulle signifie l'absence de limite. Les fonctions *_budget() 
+ * acceptent aussi un budget NULL, qui n'impose aucune limite.
+ *
+ * La mémoire comptée est une estimation de la mémoire occupée par les 
+ * structures de l'opération, pas la mémoire réellement allouée.
+ */
+typedef struct Budget {
+	long max_etats;
+	size_t max_octets;
+	double echeance;       ///< Date limite, voir horloge_budget().
+	atomic_int annule;
+} Budget;
+
+/**
+ * @brief Initialise un budget sans limite.
+ */
+void initialiser_budget( Budget * budget );
+
+/**
+ * @brief Renvoie l'heure courante d'une horloge monotone, en secondes.
+ */
+double horloge_budget();
+
+/**
+ * @brief Fixe la date limite du budget à un certain délai à partir de 
+ *        maintenant.
+ */
+void fixer_delai_budget( Budget * budget, double secondes );
+
+/**
+ * @brief Annule les opérations utilisant le budget.
+ *
+ * Peut être appelée depuis un autre thread : l'opération s'interrompt à sa 
+ * prochaine vérification du budget.
+ */
+void annuler_budget( Budget * budget );
+
+/**
+ * @brief Vérifie que le budget est respecté.
+ *
+ * @param budget Un budget, ou NULL.
+ * @param nb_etats Le nombre d'états construits.
+ * @param octets La mémoire utilisée, en octets.
+ * @return BUDGET_RESPECTE, ou la raison du dépassement.
+ */
+Statut_budget verifier_budget( Budget * budget, long nb_etats, size_t octets );
+
+/**
+ * @brief Renvoie une description du statut.
+ */
+const char * message_statut_budget( Statut_budget statut );
+
+#endif
@@ -0,0 +1,260 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2014, 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "composantes.h"
+#include "automate.h"
+#include "ensemble.h"
+#include "outils.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+Composantes * creer_composantes( const Graphe * graphe ){
+	int n = graphe->nb_etats;
+	int nb_lettres = graphe->nb_lettres;
+	const int * debut = graphe->debut;
+	const int * fins = graphe->fins;
+
+	int * index = xmalloc( ( n + 1 ) * sizeof(int) );
+	int * bas = xmalloc( ( n + 1 ) * sizeof(int) );
+	int * pile = xmalloc( ( n + 1 ) * sizeof(int) );
+	char * sur_pile = xmalloc( n + 1 );
+	int * appels = xmalloc( ( n + 1 ) * sizeof(int) );
+	int * positions = xmalloc( ( n + 1 ) * sizeof(int) );
+	int * ordre_fin = xmalloc( ( n + 1 ) * sizeof(int) );
+	memset( sur_pile, 0, n + 1 );
+	int i, k;
+	for( i=0; i<n; i++ ) index[i] = -1;
+
+	int compteur = 0;
+	int hauteur_pile = 0;
+	int nb_composantes = 0;
+	int source;
+	for( source=0; source<n; source++ ){
+		if( index[source] >= 0 ) continue;
+		int nb_appels = 0;
+		index[source] = bas[source] = compteur++;
+		pile[ hauteur_pile++ ] = source;
+		sur_pile[source] = 1;
+		appels[ nb_appels ] = source;
+		positions[ nb_appels++ ] = debut[ source * nb_lettres ];
+		while( nb_appels > 0 ){
+			int v = appels[ nb_appels - 1 ];
+			k = positions[ nb_appels - 1 ];
+			if( k < debut[ ( v + 1 ) * nb_lettres ] ){
+				// Transition suivante de v.
+				positions[ nb_appels - 1 ]++;
+				int w = fins[k];
+				if( index[w] < 0 ){
+					index[w] = bas[w] = compteur++;
+					pile[ hauteur_pile++ ] = w;
+					sur_pile[w] = 1;
+					appels[ nb_appels ] = w;
+					positions[ nb_appels++ ] = debut[ w * nb_lettres ];
+				}else if( sur_pile[w] && index[w] < bas[v] ){
+					bas[v] = index[w];
+				}
+				continue;
+			}
+			// Toutes les transitions de v sont traitées.
+			nb_appels--;
+			if( nb_appels > 0 ){
+				int u = appels[ nb_appels - 1 ];
+				if( bas[v] < bas[u] ) bas[u] = bas[v];
+			}
+			if( bas[v] == index[v] ){
+				int w;
+				do{
+					w = pile[ --hauteur_pile ];
+					sur_pile[w] = 0;
+					ordre_fin[w] = nb_composantes;
+				}while( w != v );
+				nb_composantes++;
+			}
+		}
+	}
+
+	// Tarjan termine les composantes dans l'ordre topologique inverse.
+	Composantes * res = xmalloc( sizeof(Composantes) );
+	res->nb_composantes = nb_composantes;
+	res->composante = ordre_fin;
+	for( i=0; i<n; i++ ){
+		res->composante[i] = nb_composantes - 1 - res->composante[i];
+	}
+
+	// Membres, par tri par dénombrement.
+	res->debut_membres = xmalloc( ( nb_composantes + 1 ) * sizeof(int) );
+	memset( res->debut_membres, 0, ( nb_composantes + 1 ) * sizeof(int) );
+	for( i=0; i<n; i++ ) res->debut_membres[ res->composante[i] + 1 ]++;
+	int c;
+	for( c=0; c<nb_composantes; c++ ){
+		res->debut_membres[c+1] += res->debut_membres[c];
+	}
+	res->membres = xmalloc( ( n + 1 ) * sizeof(int) );
+	int * place = bas;
+	memcpy( place, res->debut_membres, nb_composantes * sizeof(int) );
+	for( i=0; i<n; i++ ){
+		res->membres[ place[ res->composante[i] ]++ ] = i;
+	}
+
+	// Composantes cycliques et arcs du graphe des composantes.
+	res->cyclique = xmalloc( nb_composantes + 1 );
+	memset( res->cyclique, 0, nb_composantes + 1 );
+	res->debut_successeurs = xmalloc( ( nb_composantes + 1 ) * sizeof(int) );
+	res->successeurs = xmalloc( ( graphe->nb_transitions + 1 ) * sizeof(int) );
+	int * marque = index;
+	for( c=0; c<nb_composantes; c++ ) marque[c] = -1;
+	int nb_successeurs = 0;
+	for( c=0; c<nb_composantes; c++ ){
+		res->debut_successeurs[c] = nb_successeurs;
+		if( res->debut_membres[c+1] - res->debut_membres[c] > 1 ){
+			res->cyclique[c] = 1;
+		}
+		int m;
+		for( m=res->debut_membres[c]; m<res->debut_membres[c+1]; m++ ){
+			int v = res->membres[m];
+			for( 
+				k=debut[ v * nb_lettres ]; k<debut[ ( v + 1 ) * nb_lettres ]; k++ 
+			){
+				int d = res->composante[ fins[k] ];
+				if( fins[k] == v ){
+					res->cyclique[c] = 1;
+				}else if( d != c && marque[d] != c ){
+					marque[d] = c;
+					res->successeurs[ nb_successeurs++ ] = d;
+				}
+			}
+		}
+	}
+	res->debut_successeurs[ nb_composantes ] = nb_successeurs;
+
+	xfree( index );
+	xfree( bas );
+	xfree( pile );
+	xfree( sur_pile );
+	xfree( appels );
+	xfree( positions );
+	return res;
+}
+
+void liberer_composantes( Composantes * composantes ){
+	xfree( composantes->composante );
+	xfree( composantes->debut_membres );
+	xfree( composantes->membres );
+	xfree( composantes->cyclique );
+	xfree( composantes->debut_successeurs );
+	xfree( composantes->successeurs );
+	xfree( composantes );
+}
+
+char * etats_utiles_graphe( Graphe * graphe ){
+	calculer_inverse_graphe( graphe );
+	size_t nb_mots = NB_MOTS_BITS( graphe->nb_etats ) + 1;
+	uint64_t * accessibles = xmalloc( nb_mots * sizeof(uint64_t) );
+	uint64_t * co_accessibles = xmalloc( nb_mots * sizeof(uint64_t) );
+	memset( accessibles, 0, nb_mots * sizeof(uint64_t) );
+	memset( co_accessibles, 0, nb_mots * sizeof(uint64_t) );
+	int * finaux = xmalloc( ( graphe->nb_etats + 1 ) * sizeof(int) );
+	int nb_finaux = 0;
+	int i;
+	for( i=0; i<graphe->nb_etats; i++ ){
+		if( graphe->final[i] ) finaux[ nb_finaux++ ] = i;
+	}
+	parcourir_graphe( 
+		graphe, graphe->initiaux, graphe->nb_initiaux, 0, accessibles, NULL 
+	);
+	parcourir_graphe( graphe, finaux, nb_finaux, 1, co_accessibles, NULL );
+
+	char * utile = xmalloc( graphe->nb_etats + 1 );
+	for( i=0; i<graphe->nb_etats; i++ ){
+		utile[i] = TESTER_BIT( accessibles, i ) && TESTER_BIT( co_accessibles, i );
+	}
+	xfree( accessibles );
+	xfree( co_accessibles );
+	xfree( finaux );
+	return utile;
+}
+
+Ensemble * etats_sur_un_cycle( const Automate * automate ){
+	Graphe * graphe = creer_graphe( automate );
+	Composantes * composantes = creer_composantes( graphe );
+	Ensemble * res = creer_ensemble( NULL, NULL, NULL );
+	int i;
+	for( i=0; i<graphe->nb_etats; i++ ){
+		if( composantes->cyclique[ composantes->composante[i] ] ){
+			ajouter_element( res, graphe->etats[i] );
+		}
+	}
+	liberer_composantes( composantes );
+	liberer_graphe( graphe );
+	return res;
+}
+
+bool langage_est_fini( const Automate * automate ){
+	int longueur;
+	return longueur_maximale_mot( automate, &longueur );
+}
+
+bool longueur_maximale_mot( const Automate * automate, int * longueur ){
+	Graphe * graphe = creer_graphe( automate );
+	Composantes * composantes = creer_composantes( graphe );
+	char * utile = etats_utiles_graphe( graphe );
+	int nb_lettres = graphe->nb_lettres;
+	bool fini = true;
+	int i, k;
+	for( i=0; i<graphe->nb_etats; i++ ){
+		if( utile[i] && composantes->cyclique[ composantes->composante[i] ] ){
+			fini = false;
+		}
+	}
+
+	if( fini ){
+		// Les états utiles forment un graphe acyclique : on les traite dans 
+		// l'ordre topologique inverse.
+		int * plus_long = xmalloc( ( graphe->nb_etats + 1 ) * sizeof(int) );
+		int m;
+		for( m=graphe->nb_etats-1; m>=0; m-- ){
+			int v = composantes->membres[m];
+			if( ! utile[v] ) continue;
+			plus_long[v] = graphe->final[v] ? 0 : -1;
+			for( 
+				k=graphe->debut[ v * nb_lettres ]; 
+				k<graphe->debut[ ( v + 1 ) * nb_lettres ]; 
+				k++ 
+			){
+				int w = graphe->fins[k];
+				if( utile[w] && plus_long[w] + 1 > plus_long[v] ){
+					plus_long[v] = plus_long[w] + 1;
+				}
+			}
+		}
+		*longueur = -1;
+		for( i=0; i<graphe->nb_initiaux; i++ ){
+			int v = graphe->initiaux[i];
+			if( utile[v] && plus_long[v] > *longueur ) *longueur = plus_long[v];
+		}
+		xfree( plus_long );
+	}
+
+	xfree( utile );
+	liberer_composantes( composantes );
+	liberer_graphe( graphe );
+	return fini;
+}
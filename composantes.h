@@ -0,0 +1,109 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2014, 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file composantes.h */ 
+
+#ifndef __COMPOSANTES_H__
+#define __COMPOSANTES_H__
+
+#include "graphe.h"
+
+#include <stdbool.h>
+
+/**
+ * @brief Composantes fortement connexes d'un index d'adjacence, et graphe 
+ * acyclique des composantes.
+ *
+ * Les composantes sont numérotées de 0 à nb_composantes-1 dans un ordre 
+ * topologique : toute transition d'un état de la composante c vers un état 
+ * d'une autre composante c' vérifie c < c'.
+ * Les indices des états de la composante c sont 
+ * membres[ debut_membres[c] ] ... membres[ debut_membres[c+1] - 1 ], et les 
+ * composantes successeurs de c (sans répétition, et sans c) sont 
+ * successeurs[ debut_successeurs[c] ] ... 
+ * successeurs[ debut_successeurs[c+1] - 1 ].
+ */
+typedef struct Composantes {
+	int nb_composantes;
+	int * composante;           //!< Indice d'état -> composante.
+	int * debut_membres;        //!< Taille nb_composantes+1.
+	int * membres;
+	char * cyclique;            //!< cyclique[c] vaut 1 si la composante c contient un cycle.
+	int * debut_successeurs;    //!< Taille nb_composantes+1.
+	int * successeurs;
+} Composantes;
+
+/**
+ * @brief Calcule les composantes fortement connexes d'un index, en temps 
+ * linéaire (algorithme de Tarjan, sans récursion).
+ *
+ * @param graphe Un index d'adjacence.
+ * @return Les composantes, indépendantes de l'index du point de vue de la 
+ *         mémoire.
+ */
+Composantes * creer_composantes( const Graphe * graphe );
+
+/**
+ * @brief Détruit des composantes.
+ *
+ * @param composantes Les composantes à détruire.
+ */
+void liberer_composantes( Composantes * composantes );
+
+/**
+ * @brief Renvoie les états utiles (accessibles et co-accessibles) d'un 
+ * index.
+ *
+ * @param graphe Un index ; son index inverse est calculé si besoin.
+ * @return Un tableau de nb_etats caractères, à libérer avec xfree() : 
+ *         la case i vaut 1 si l'état d'indice i est utile.
+ */
+char * etats_utiles_graphe( Graphe * graphe );
+
+/**
+ * @brief Renvoie les états d'un automate qui appartiennent à un cycle.
+ *
+ * @param automate Un automate.
+ * @return Les états.
+ */
+Ensemble * etats_sur_un_cycle( const Automate * automate );
+
+/**
+ * @brief Teste si le langage d'un automate est fini, en temps linéaire.
+ *
+ * Le langage est infini si et seulement si un cycle passe par un état utile.
+ *
+ * @param automate Un automate.
+ * @return true si le langage est fini.
+ */
+bool langage_est_fini( const Automate * automate );
+
+/**
+ * @brief Calcule la longueur du plus long mot reconnu par un automate, en 
+ * temps linéaire.
+ *
+ * @param automate Un automate.
+ * @param longueur Si le langage est fini, reçoit la longueur du plus long 
+ *        mot reconnu, ou -1 si le langage est vide.
+ * @return false si le langage est infini.
+ */
+bool longueur_maximale_mot( const Automate * automate, int * longueur );
+
+#endif
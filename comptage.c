@@ -0,0 +1,376 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2014, 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "comptage.h"
+#include "graphe.h"
+#include "composantes.h"
+#include "outils.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * @brief Transitions utiles d'un automate, sans leurs lettres : deux 
+ * transitions de mêmes extrémités et de lettres différentes donnent deux arcs.
+ */
+typedef struct {
+	int nb_etats;
+	int nb_arcs;
+	int * origines;
+	int * fins;
+	int nb_initiaux;
+	int * initiaux;
+	int nb_finaux;
+	int * finaux;
+} Arcs_comptage;
+
+void preparer_arcs_comptage( const Automate * automate, Arcs_comptage * arcs ){
+	Graphe * graphe = creer_graphe( automate );
+	char * utile = etats_utiles_graphe( graphe );
+	int * numero = xmalloc( ( graphe->nb_etats + 1 ) * sizeof(int) );
+	int i, k;
+	arcs->nb_etats = 0;
+	for( i=0; i<graphe->nb_etats; i++ ){
+		numero[i] = utile[i] ? arcs->nb_etats++ : -1;
+	}
+	arcs->origines = xmalloc( ( graphe->nb_transitions + 1 ) * sizeof(int) );
+	arcs->fins = xmalloc( ( graphe->nb_transitions + 1 ) * sizeof(int) );
+	arcs->nb_arcs = 0;
+	for( i=0; i<graphe->nb_etats; i++ ){
+		if( ! utile[i] ) continue;
+		for( 
+			k=graphe->debut[ i * graphe->nb_lettres ]; 
+			k<graphe->debut[ ( i + 1 ) * graphe->nb_lettres ]; 
+			k++ 
+		){
+			if( utile[ graphe->fins[k] ] ){
+				arcs->origines[ arcs->nb_arcs ] = numero[i];
+				arcs->fins[ arcs->nb_arcs++ ] = numero[ graphe->fins[k] ];
+			}
+		}
+	}
+	arcs->initiaux = xmalloc( ( graphe->nb_initiaux + 1 ) * sizeof(int) );
+	arcs->nb_initiaux = 0;
+	for( i=0; i<graphe->nb_initiaux; i++ ){
+		if( utile[ graphe->initiaux[i] ] ){
+			arcs->initiaux[ arcs->nb_initiaux++ ] = numero[ graphe->initiaux[i] ];
+		}
+	}
+	arcs->finaux = xmalloc( ( arcs->nb_etats + 1 ) * sizeof(int) );
+	arcs->nb_finaux = 0;
+	for( i=0; i<graphe->nb_etats; i++ ){
+		if( utile[i] && graphe->final[i] ){
+			arcs->finaux[ arcs->nb_finaux++ ] = numero[i];
+		}
+	}
+	xfree( numero );
+	xfree( utile );
+	liberer_graphe( graphe );
+}
+
+void liberer_arcs_comptage( Arcs_comptage * arcs ){
+	xfree( arcs->origines );
+	xfree( arcs->fins );
+	xfree( arcs->initiaux );
+	xfree( arcs->finaux );
+}
+
+uint64_t addition_modulo( uint64_t a, uint64_t b, uint64_t modulo ){
+	uint64_t somme = a + b;
+	if( somme < a || somme >= modulo ) somme -= modulo;
+	return somme;
+}
+
+uint64_t multiplication_modulo( uint64_t a, uint64_t b, uint64_t modulo ){
+	return (uint64_t) ( (unsigned __int128) a * b % modulo );
+}
+
+/**
+ * @brief Initialise les comptes des chemins de longueur 0, et renvoie le 
+ * nombre de ceux qui sont acceptants.
+ */
+uint64_t initialiser_comptes_modulo( 
+	const Arcs_comptage * arcs, uint64_t * comptes, uint64_t modulo 
+){
+	int i;
+	memset( comptes, 0, ( arcs->nb_etats + 1 ) * sizeof(uint64_t) );
+	for( i=0; i<arcs->nb_initiaux; i++ ){
+		comptes[ arcs->initiaux[i] ] = 1 % modulo;
+	}
+	uint64_t total = 0;
+	for( i=0; i<arcs->nb_finaux; i++ ){
+		total = addition_modulo( total, comptes[ arcs->finaux[i] ], modulo );
+	}
+	return total;
+}
+
+/**
+ * @brief Propage les comptes le long des arcs (une lettre de plus), et 
+ * renvoie le nombre de chemins acceptants.
+ */
+uint64_t propager_comptes_modulo(
+	const Arcs_comptage * arcs, const uint64_t * comptes, uint64_t * suivants,
+	uint64_t modulo
+){
+	int i;
+	memset( suivants, 0, ( arcs->nb_etats + 1 ) * sizeof(uint64_t) );
+	for( i=0; i<arcs->nb_arcs; i++ ){
+		suivants[ arcs->fins[i] ] = addition_modulo( 
+			suivants[ arcs->fins[i] ], comptes[ arcs->origines[i] ], modulo 
+		);
+	}
+	uint64_t total = 0;
+	for( i=0; i<arcs->nb_finaux; i++ ){
+		total = addition_modulo( total, suivants[ arcs->finaux[i] ], modulo );
+	}
+	return total;
+}
+
+uint64_t * suite_nombre_de_mots_modulo( 
+	const Automate * automate, int n, uint64_t modulo 
+){
+	Arcs_comptage arcs;
+	preparer_arcs_comptage( automate, &arcs );
+	uint64_t * comptes = xmalloc( ( arcs.nb_etats + 1 ) * sizeof(uint64_t) );
+	uint64_t * suivants = xmalloc( ( arcs.nb_etats + 1 ) * sizeof(uint64_t) );
+	uint64_t * res = xmalloc( ( n + 1 ) * sizeof(uint64_t) );
+	res[0] = initialiser_comptes_modulo( &arcs, comptes, modulo );
+	int longueur;
+	for( longueur=1; longueur<=n; longueur++ ){
+		res[longueur] = propager_comptes_modulo( &arcs, comptes, suivants, modulo );
+		uint64_t * tmp = comptes;
+		comptes = suivants;
+		suivants = tmp;
+	}
+	xfree( comptes );
+	xfree( suivants );
+	liberer_arcs_comptage( &arcs );
+	return res;
+}
+
+/**
+ * @brief Calcule produit = a * b, pour des matrices carrées de taille k.
+ */
+void multiplier_matrices_modulo(
+	const uint64_t * a, const uint64_t * b, uint64_t * produit, int k, 
+	uint64_t modulo
+){
+	int i, j, l;
+	memset( produit, 0, (size_t) k * k * sizeof(uint64_t) );
+	for( i=0; i<k; i++ ){
+		for( l=0; l<k; l++ ){
+			uint64_t x = a[ (size_t) i * k + l ];
+			if( x == 0 ) continue;
+			for( j=0; j<k; j++ ){
+				produit[ (size_t) i * k + j ] = addition_modulo(
+					produit[ (size_t) i * k + j ], 
+					multiplication_modulo( x, b[ (size_t) l * k + j ], modulo ),
+					modulo
+				);
+			}
+		}
+	}
+}
+
+uint64_t nombre_de_mots_modulo( 
+	const Automate * automate, uint64_t n, uint64_t modulo 
+){
+	Arcs_comptage arcs;
+	preparer_arcs_comptage( automate, &arcs );
+	int k = arcs.nb_etats;
+	uint64_t * comptes = xmalloc( ( k + 1 ) * sizeof(uint64_t) );
+	uint64_t * suivants = xmalloc( ( k + 1 ) * sizeof(uint64_t) );
+	uint64_t total = initialiser_comptes_modulo( &arcs, comptes, modulo );
+	int i, j;
+
+	double bits = 0;
+	uint64_t reste;
+	for( reste=n; reste; reste >>= 1 ) bits++;
+	double cout_propagation = (double) n * ( arcs.nb_arcs + k );
+	double cout_matrices = 2 * bits * k * (double) k * k;
+
+	if( cout_propagation <= cout_matrices ){
+		uint64_t longueur;
+		for( longueur=1; longueur<=n; longueur++ ){
+			total = propager_comptes_modulo( &arcs, comptes, suivants, modulo );
+			uint64_t * tmp = comptes;
+			comptes = suivants;
+			suivants = tmp;
+		}
+	}else{
+		// comptes * M^n par exponentiation rapide, M étant la matrice de 
+		// transfert : M[i][j] est le nombre d'arcs de i vers j.
+		uint64_t * puissance = xmalloc( (size_t) k * k * sizeof(uint64_t) );
+		uint64_t * carre = xmalloc( (size_t) k * k * sizeof(uint64_t) );
+		memset( puissance, 0, (size_t) k * k * sizeof(uint64_t) );
+		for( i=0; i<arcs.nb_arcs; i++ ){
+			uint64_t * case_matrice = 
+				&puissance[ (size_t) arcs.origines[i] * k + arcs.fins[i] ];
+			*case_matrice = addition_modulo( *case_matrice, 1 % modulo, modulo );
+		}
+		for( reste=n; reste; reste >>= 1 ){
+			if( reste & 1 ){
+				memset( suivants, 0, ( k + 1 ) * sizeof(uint64_t) );
+				for( i=0; i<k; i++ ){
+					if( comptes[i] == 0 ) continue;
+					for( j=0; j<k; j++ ){
+						suivants[j] = addition_modulo( 
+							suivants[j], 
+							multiplication_modulo( 
+								comptes[i], puissance[ (size_t) i * k + j ], modulo 
+							),
+							modulo
+						);
+					}
+				}
+				uint64_t * tmp = comptes;
+				comptes = suivants;
+				suivants = tmp;
+			}
+			if( reste > 1 ){
+				multiplier_matrices_modulo( puissance, puissance, carre, k, modulo );
+				uint64_t * tmp = puissance;
+				puissance = carre;
+				carre = tmp;
+			}
+		}
+		total = 0;
+		for( i=0; i<arcs.nb_finaux; i++ ){
+			total = addition_modulo( total, comptes[ arcs.finaux[i] ], modulo );
+		}
+		xfree( puissance );
+		xfree( carre );
+	}
+
+	xfree( comptes );
+	xfree( suivants );
+	liberer_arcs_comptage( &arcs );
+	return total;
+}
+
+/**
+ * @brief Ajoute b à a, pour des entiers de nb_chiffres chiffres en base 2^32
+ * (poids faibles en premier).
+ */
+void ajouter_grands_entiers( uint32_t * a, const uint32_t * b, int nb_chiffres ){
+	uint64_t retenue = 0;
+	int i;
+	for( i=0; i<nb_chiffres; i++ ){
+		retenue += (uint64_t) a[i] + b[i];
+		a[i] = (uint32_t) retenue;
+		retenue >>= 32;
+	}
+}
+
+char * ecrire_grand_entier( uint32_t * a, int nb_chiffres ){
+	// Divisions successives par 10^9 ; a est détruit.
+	int nb_blocs = 0;
+	uint32_t * blocs = xmalloc( ( nb_chiffres * 10 / 9 + 2 ) * sizeof(uint32_t) );
+	while( nb_chiffres > 0 && a[ nb_chiffres - 1 ] == 0 ) nb_chiffres--;
+	while( nb_chiffres > 0 ){
+		uint64_t reste = 0;
+		int i;
+		for( i=nb_chiffres-1; i>=0; i-- ){
+			uint64_t courant = ( reste << 32 ) | a[i];
+			a[i] = (uint32_t) ( courant / 1000000000 );
+			reste = courant % 1000000000;
+		}
+		blocs[ nb_blocs++ ] = (uint32_t) reste;
+		while( nb_chiffres > 0 && a[ nb_chiffres - 1 ] == 0 ) nb_chiffres--;
+	}
+	char * res = xmalloc( 9 * nb_blocs + 2 );
+	if( nb_blocs == 0 ){
+		strcpy( res, "0" );
+	}else{
+		int longueur = sprintf( res, "%u", blocs[ nb_blocs - 1 ] );
+		int i;
+		for( i=nb_blocs-2; i>=0; i-- ){
+			longueur += sprintf( res + longueur, "%09u", blocs[i] );
+		}
+	}
+	xfree( blocs );
+	return res;
+}
+
+char * nombre_de_mots( const Automate * automate, int n ){
+	Arcs_comptage arcs;
+	preparer_arcs_comptage( automate, &arcs );
+	int k = arcs.nb_etats;
+	int i, longueur;
+
+	// Les comptes ont nb_chiffres chiffres, dont le dernier est toujours 
+	// nul : une somme d'au plus nb_arcs comptes ne déborde donc pas.
+	int nb_chiffres = 2;
+	uint32_t * comptes = xmalloc( ( k + 1 ) * nb_chiffres * sizeof(uint32_t) );
+	uint32_t * suivants = xmalloc( ( k + 1 ) * nb_chiffres * sizeof(uint32_t) );
+	memset( comptes, 0, ( k + 1 ) * nb_chiffres * sizeof(uint32_t) );
+	for( i=0; i<arcs.nb_initiaux; i++ ){
+		comptes[ arcs.initiaux[i] * nb_chiffres ] = 1;
+	}
+	for( longueur=1; longueur<=n; longueur++ ){
+		memset( suivants, 0, ( k + 1 ) * nb_chiffres * sizeof(uint32_t) );
+		for( i=0; i<arcs.nb_arcs; i++ ){
+			ajouter_grands_entiers( 
+				&suivants[ arcs.fins[i] * nb_chiffres ], 
+				&comptes[ arcs.origines[i] * nb_chiffres ], nb_chiffres 
+			);
+		}
+		uint32_t * tmp = comptes;
+		comptes = suivants;
+		suivants = tmp;
+
+		int deborde = 0;
+		for( i=0; i<k; i++ ){
+			deborde |= comptes[ i * nb_chiffres + nb_chiffres - 1 ] != 0;
+		}
+		if( deborde ){
+			// Un chiffre de plus pour chaque compte.
+			xfree( suivants );
+			suivants = xmalloc( ( k + 1 ) * ( nb_chiffres + 1 ) * sizeof(uint32_t) );
+			memset( suivants, 0, ( k + 1 ) * ( nb_chiffres + 1 ) * sizeof(uint32_t) );
+			for( i=0; i<k; i++ ){
+				memcpy( 
+					&suivants[ i * ( nb_chiffres + 1 ) ], &comptes[ i * nb_chiffres ], 
+					nb_chiffres * sizeof(uint32_t) 
+				);
+			}
+			xfree( comptes );
+			comptes = suivants;
+			nb_chiffres++;
+			suivants = xmalloc( ( k + 1 ) * nb_chiffres * sizeof(uint32_t) );
+		}
+	}
+
+	uint32_t * total = xmalloc( nb_chiffres * sizeof(uint32_t) );
+	memset( total, 0, nb_chiffres * sizeof(uint32_t) );
+	for( i=0; i<arcs.nb_finaux; i++ ){
+		ajouter_grands_entiers( 
+			total, &comptes[ arcs.finaux[i] * nb_chiffres ], nb_chiffres 
+		);
+	}
+	char * res = ecrire_grand_entier( total, nb_chiffres );
+
+	xfree( total );
+	xfree( comptes );
+	xfree( suivants );
+	liberer_arcs_comptage( &arcs );
+	return res;
+}
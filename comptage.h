@@ -0,0 +1,83 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2014, 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file comptage.h */ 
+
+#ifndef __COMPTAGE_H__
+#define __COMPTAGE_H__
+
+#include "automate.h"
+
+#include <stdint.h>
+
+/**
+ * @brief Compte les mots de longueur n reconnus par un automate déterministe,
+ *        modulo un entier.
+ *
+ * Le calcul se fait sur les seuls états utiles. Selon la taille de 
+ * l'automate et n, il itère n fois la propagation des comptes le long des 
+ * transitions (en O(n * nombre de transitions)), ou élève la matrice de 
+ * transfert à la puissance n par exponentiation rapide (en 
+ * O(nombre d'états^3 * log n)), en choisissant le moins coûteux.
+ *
+ * Pour un automate non déterministe, le résultat est le nombre de chemins 
+ * acceptants de longueur n : un mot est compté autant de fois qu'il a de 
+ * chemins acceptants.
+ *
+ * @param automate Un automate déterministe (par exemple le résultat de 
+ *        creer_automate_deterministe()).
+ * @param n La longueur des mots.
+ * @param modulo Le module, non nul.
+ * @return Le nombre de mots de longueur n reconnus, modulo 'modulo'.
+ */
+uint64_t nombre_de_mots_modulo( 
+	const Automate * automate, uint64_t n, uint64_t modulo 
+);
+
+/**
+ * @brief Compte les mots de chaque longueur de 0 à n reconnus par un automate
+ *        déterministe, modulo un entier, en O(n * nombre de transitions).
+ *
+ * @param automate Un automate déterministe (voir nombre_de_mots_modulo()).
+ * @param n La longueur maximale.
+ * @param modulo Le module, non nul.
+ * @return Un tableau de n+1 entiers, à libérer avec xfree(), dont la case i 
+ *         est le nombre de mots de longueur i reconnus, modulo 'modulo'.
+ */
+uint64_t * suite_nombre_de_mots_modulo( 
+	const Automate * automate, int n, uint64_t modulo 
+);
+
+/**
+ * @brief Compte exactement les mots de longueur n reconnus par un automate 
+ *        déterministe.
+ *
+ * Le compte est calculé en précision arbitraire par propagation le long des
+ * transitions ; le nombre de chiffres croissant linéairement avec n, le coût
+ * est quadratique en n. Pour de grandes valeurs de n, il vaut mieux utiliser
+ * nombre_de_mots_modulo().
+ *
+ * @param automate Un automate déterministe (voir nombre_de_mots_modulo()).
+ * @param n La longueur des mots.
+ * @return L'écriture décimale du nombre de mots, à libérer avec xfree().
+ */
+char * nombre_de_mots( const Automate * automate, int n );
+
+#endif
@@ -0,0 +1,219 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2014, 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "concurrent.h"
+#include "vecteurs.h"
+#include "outils.h"
+
+#include <pthread.h>
+#include <string.h>
+
+typedef struct {
+	pthread_mutex_t verrou;
+	Table_vecteurs * table;
+} Sous_table_vecteurs;
+
+struct Table_vecteurs_concurrente {
+	int nb_sous_tables;   // Toujours une puissance de 2.
+	int decalage;         // log2( nb_sous_tables ).
+	Sous_table_vecteurs * sous_tables;
+};
+
+Table_vecteurs_concurrente * creer_table_vecteurs_concurrente( int nb_sous_tables ){
+	Table_vecteurs_concurrente * table = xmalloc( sizeof(Table_vecteurs_concurrente) );
+	table->nb_sous_tables = 1;
+	table->decalage = 0;
+	while( table->nb_sous_tables < nb_sous_tables ){
+		table->nb_sous_tables *= 2;
+		table->decalage++;
+	}
+	table->sous_tables = xmalloc( table->nb_sous_tables * sizeof(Sous_table_vecteurs) );
+	int i;
+	for( i=0; i<table->nb_sous_tables; i++ ){
+		pthread_mutex_init( &table->sous_tables[i].verrou, NULL );
+		table->sous_tables[i].table = creer_table_vecteurs();
+	}
+	return table;
+}
+
+void liberer_table_vecteurs_concurrente( Table_vecteurs_concurrente * table ){
+	int i;
+	for( i=0; i<table->nb_sous_tables; i++ ){
+		pthread_mutex_destroy( &table->sous_tables[i].verrou );
+		liberer_table_vecteurs( table->sous_tables[i].table );
+	}
+	xfree( table->sous_tables );
+	xfree( table );
+}
+
+int nb_sous_tables_vecteurs( const Table_vecteurs_concurrente * table ){
+	return table->nb_sous_tables;
+}
+
+int interner_vecteur_concurrent(
+	Table_vecteurs_concurrente * table, const uint64_t * mots, int nb_mots,
+	int * nouveau
+){
+	// Les bits de poids faible servent déjà à l'adressage dans la sous-table.
+	int s = (int) ( hacher_vecteur( mots, nb_mots ) >> 40 ) & ( table->nb_sous_tables - 1 );
+	Sous_table_vecteurs * sous_table = &table->sous_tables[s];
+	pthread_mutex_lock( &sous_table->verrou );
+	int local = interner_vecteur( sous_table->table, mots, nb_mots, nouveau );
+	pthread_mutex_unlock( &sous_table->verrou );
+	return ( local << table->decalage ) | s;
+}
+
+int copier_vecteur_concurrent(
+	Table_vecteurs_concurrente * table, int numero, uint64_t ** tampon,
+	int * capacite
+){
+	Sous_table_vecteurs * sous_table = 
+		&table->sous_tables[ numero & ( table->nb_sous_tables - 1 ) ];
+	int nb_mots;
+	// Le vecteur peut être déplacé par une insertion concurrente : la copie 
+	// se fait sous le verrou.
+	pthread_mutex_lock( &sous_table->verrou );
+	const uint64_t * mots = get_vecteur(
+		sous_table->table, numero >> table->decalage, &nb_mots
+	);
+	if( nb_mots > *capacite ){
+		while( *capacite < nb_mots ) *capacite *= 2;
+		*tampon = xrealloc( *tampon, *capacite * sizeof(uint64_t) );
+	}
+	memcpy( *tampon, mots, nb_mots * sizeof(uint64_t) );
+	pthread_mutex_unlock( &sous_table->verrou );
+	return nb_mots;
+}
+
+int taille_sous_table_vecteurs(
+	Table_vecteurs_concurrente * table, int sous_table
+){
+	Sous_table_vecteurs * s = &table->sous_tables[sous_table];
+	pthread_mutex_lock( &s->verrou );
+	int taille = taille_table_vecteurs( s->table );
+	pthread_mutex_unlock( &s->verrou );
+	return taille;
+}
+
+struct File_de_travail {
+	pthread_mutex_t verrou;
+	int * taches;         // Tampon circulaire.
+	int capacite;         // Toujours une puissance de 2.
+	int debut;            // Côté des voleurs.
+	int taille;
+};
+
+File_de_travail * creer_file_de_travail(){
+	File_de_travail * file = xmalloc( sizeof(File_de_travail) );
+	pthread_mutex_init( &file->verrou, NULL );
+	file->capacite = 64;
+	file->taches = xmalloc( file->capacite * sizeof(int) );
+	file->debut = 0;
+	file->taille = 0;
+	return file;
+}
+
+void liberer_file_de_travail( File_de_travail * file ){
+	pthread_mutex_destroy( &file->verrou );
+	xfree( file->taches );
+	xfree( file );
+}
+
+void pousser_travail( File_de_travail * file, int tache ){
+	pthread_mutex_lock( &file->verrou );
+	if( file->taille == file->capacite ){
+		int * taches = xmalloc( 2 * file->capacite * sizeof(int) );
+		int i;
+		for( i=0; i<file->taille; i++ ){
+			taches[i] = file->taches[ ( file->debut + i ) & ( file->capacite - 1 ) ];
+		}
+		xfree( file->taches );
+		file->taches = taches;
+		file->capacite *= 2;
+		file->debut = 0;
+	}
+	file->taches[ ( file->debut + file->taille ) & ( file->capacite - 1 ) ] = tache;
+	file->taille++;
+	pthread_mutex_unlock( &file->verrou );
+}
+
+int prendre_travail( File_de_travail * file, int * tache ){
+	int res = 0;
+	pthread_mutex_lock( &file->verrou );
+	if( file->taille > 0 ){
+		file->taille--;
+		*tache = file->taches[ ( file->debut + file->taille ) & ( file->capacite - 1 ) ];
+		res = 1;
+	}
+	pthread_mutex_unlock( &file->verrou );
+	return res;
+}
+
+int voler_travail( File_de_travail * file, int * tache ){
+	int res = 0;
+	pthread_mutex_lock( &file->verrou );
+	if( file->taille > 0 ){
+		*tache = file->taches[ file->debut ];
+		file->debut = ( file->debut + 1 ) & ( file->capacite - 1 );
+		file->taille--;
+		res = 1;
+	}
+	pthread_mutex_unlock( &file->verrou );
+	return res;
+}
+
+struct Barriere {
+	pthread_mutex_t verrou;
+	pthread_cond_t condition;
+	int nb_threads;
+	int nb_arrives;
+	unsigned int generation;
+};
+
+Barriere * creer_barriere( int nb_threads ){
+	Barriere * barriere = xmalloc( sizeof(Barriere) );
+	pthread_mutex_init( &barriere->verrou, NULL );
+	pthread_cond_init( &barriere->condition, NULL );
+	barriere->nb_threads = nb_threads;
+	barriere->nb_arrives = 0;
+	barriere->generation = 0;
+	return barriere;
+}
+
+void liberer_barriere( Barriere * barriere ){
+	pthread_mutex_destroy( &barriere->verrou );
+	pthread_cond_destroy( &barriere->condition );
+	xfree( barriere );
+}
+
+void attendre_barriere( Barriere * barriere ){
+	pthread_mutex_lock( &barriere->verrou );
+	unsigned int generation = barriere->generation;
+	if( ++barriere->nb_arrives == barriere->nb_threads ){
+		barriere->nb_arrives = 0;
+		barriere->generation++;
+		pthread_cond_broadcast( &barriere->condition );
+	}else{
+		while( generation == barriere->generation ){
+			pthread_cond_wait( &barriere->condition, &barriere->verrou );
+		}
+	}
+	pthread_mutex_unlock( &barriere->verrou );
+}
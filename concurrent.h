@@ -0,0 +1,146 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2014, 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file concurrent.h */ 
+
+#ifndef __CONCURRENT_H__
+#define __CONCURRENT_H__
+
+#include <stdint.h>
+#include <stddef.h>
+
+/**
+ * @brief Table d'internement de vecteurs partagée entre plusieurs threads.
+ *
+ * La table est découpée en plusieurs tables de vecteurs (voir vecteurs.h), 
+ * chacune protégée par son propre verrou ; un vecteur est rangé dans la 
+ * sous-table désignée par sa valeur de hachage. Le numéro d'un vecteur est 
+ * numero_local * nb_sous_tables + sous_table : les numéros sont uniques 
+ * mais ne sont ni consécutifs, ni attribués dans un ordre reproductible.
+ */
+typedef struct Table_vecteurs_concurrente Table_vecteurs_concurrente;
+
+/**
+ * @brief Crée une table concurrente vide.
+ *
+ * @param nb_sous_tables Le nombre de sous-tables, arrondi à une puissance de 2.
+ */
+Table_vecteurs_concurrente * creer_table_vecteurs_concurrente( int nb_sous_tables );
+
+/**
+ * @brief Détruit une table concurrente.
+ */
+void liberer_table_vecteurs_concurrente( Table_vecteurs_concurrente * table );
+
+/**
+ * @brief Renvoie le nombre de sous-tables.
+ */
+int nb_sous_tables_vecteurs( const Table_vecteurs_concurrente * table );
+
+/**
+ * @brief Renvoie le numéro d'un vecteur, en l'ajoutant à la table s'il n'y
+ *        est pas encore.
+ *
+ * @param nouveau Si non NULL, reçoit 1 si le vecteur vient d'être ajouté.
+ */
+int interner_vecteur_concurrent(
+	Table_vecteurs_concurrente * table, const uint64_t * mots, int nb_mots,
+	int * nouveau
+);
+
+/**
+ * @brief Copie un vecteur de la table dans un tampon.
+ *
+ * @param tampon Un tampon alloué par xmalloc(), agrandi si besoin.
+ * @param capacite La capacité du tampon, en mots.
+ * @return Le nombre de mots du vecteur.
+ */
+int copier_vecteur_concurrent(
+	Table_vecteurs_concurrente * table, int numero, uint64_t ** tampon,
+	int * capacite
+);
+
+/**
+ * @brief Renvoie le nombre de vecteurs d'une sous-table.
+ *
+ * Les numéros locaux d'une sous-table vont de 0 à ce nombre moins 1.
+ */
+int taille_sous_table_vecteurs(
+	Table_vecteurs_concurrente * table, int sous_table
+);
+
+/**
+ * @brief File de travail d'un thread, dans laquelle les autres peuvent voler.
+ *
+ * Le thread propriétaire empile et dépile à une extrémité ; les autres 
+ * threads volent à l'autre extrémité.
+ */
+typedef struct File_de_travail File_de_travail;
+
+/**
+ * @brief Crée une file de travail vide.
+ */
+File_de_travail * creer_file_de_travail();
+
+/**
+ * @brief Détruit une file de travail.
+ */
+void liberer_file_de_travail( File_de_travail * file );
+
+/**
+ * @brief Ajoute une tâche, du côté du propriétaire.
+ */
+void pousser_travail( File_de_travail * file, int tache );
+
+/**
+ * @brief Retire la dernière tâche ajoutée (côté propriétaire).
+ *
+ * @return 1 si une tâche a été retirée, 0 si la file est vide.
+ */
+int prendre_travail( File_de_travail * file, int * tache );
+
+/**
+ * @brief Retire la plus ancienne tâche de la file (côté voleur).
+ *
+ * @return 1 si une tâche a été volée, 0 si la file est vide.
+ */
+int voler_travail( File_de_travail * file, int * tache );
+
+/**
+ * @brief Barrière de synchronisation entre un nombre fixe de threads.
+ */
+typedef struct Barriere Barriere;
+
+/**
+ * @brief Crée une barrière pour nb_threads threads.
+ */
+Barriere * creer_barriere( int nb_threads );
+
+/**
+ * @brief Détruit une barrière.
+ */
+void liberer_barriere( Barriere * barriere );
+
+/**
+ * @brief Attend que tous les threads aient atteint la barrière.
+ */
+void attendre_barriere( Barriere * barriere );
+
+#endif
@@ -0,0 +1,289 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2014, 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "determinisation.h"
+#include "graphe.h"
+#include "vecteurs.h"
+#include "outils.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+struct Espace_image {
+	uint64_t * mots;
+	size_t capacite;
+	unsigned int * marque;     // En mode tableau : évite les doublons.
+	unsigned int generation;
+};
+
+struct Determinisation {
+	Graphe * graphe;
+	int ensembles_de_bits;
+	int nb_mots;               // Taille d'une partie en mode ensemble de bits.
+	uint64_t * masques;        // [lettre][etat][mot] en mode ensemble de bits.
+	uint64_t * masque_final;
+	Table_vecteurs * parties;
+	int capacite_etats;
+	int * transitions;         // [etat][lettre], -1 si non calculée.
+	char * final;
+	Espace_image * espace;
+};
+
+int comparer_mots_determinisation( const void * a, const void * b ){
+	uint64_t x = *(const uint64_t*) a;
+	uint64_t y = *(const uint64_t*) b;
+	return ( x > y ) - ( x < y );
+}
+
+void reserver_espace_image( Espace_image * espace, size_t taille ){
+	if( taille > espace->capacite ){
+		while( espace->capacite < taille ) espace->capacite *= 2;
+		espace->mots = xrealloc( espace->mots, espace->capacite * sizeof(uint64_t) );
+	}
+}
+
+Espace_image * creer_espace_image( const Determinisation * d ){
+	Espace_image * espace = xmalloc( sizeof(Espace_image) );
+	espace->capacite = d->nb_mots + 1;
+	espace->mots = xmalloc( espace->capacite * sizeof(uint64_t) );
+	espace->generation = 0;
+	espace->marque = NULL;
+	if( ! d->ensembles_de_bits ){
+		int n = d->graphe->nb_etats;
+		espace->marque = xmalloc( ( n + 1 ) * sizeof(unsigned int) );
+		memset( espace->marque, 0, ( n + 1 ) * sizeof(unsigned int) );
+	}
+	return espace;
+}
+
+void liberer_espace_image( Espace_image * espace ){
+	xfree( espace->mots );
+	xfree( espace->marque );
+	xfree( espace );
+}
+
+const uint64_t * mots_espace_image( const Espace_image * espace ){
+	return espace->mots;
+}
+
+int partie_initiale_determinisation(
+	const Determinisation * d, Espace_image * espace
+){
+	const Graphe * g = d->graphe;
+	int i;
+	if( d->ensembles_de_bits ){
+		memset( espace->mots, 0, d->nb_mots * sizeof(uint64_t) );
+		for( i=0; i<g->nb_initiaux; i++ ) METTRE_BIT( espace->mots, g->initiaux[i] );
+		return d->nb_mots;
+	}
+	reserver_espace_image( espace, g->nb_initiaux + 1 );
+	// get_initiaux() est trié : les indices le sont aussi.
+	for( i=0; i<g->nb_initiaux; i++ ) espace->mots[i] = g->initiaux[i];
+	return g->nb_initiaux;
+}
+
+int image_partie_determinisation(
+	const Determinisation * d, const uint64_t * partie, int nb_mots,
+	int lettre, Espace_image * espace
+){
+	const Graphe * g = d->graphe;
+	int i, k;
+
+	if( d->ensembles_de_bits ){
+		int n = g->nb_etats;
+		const uint64_t * masques = d->masques + (size_t) lettre * n * d->nb_mots;
+		memset( espace->mots, 0, d->nb_mots * sizeof(uint64_t) );
+		for( i=0; i<nb_mots; i++ ){
+			uint64_t mot = partie[i];
+			while( mot ){
+				int q = i*64 + __builtin_ctzll( mot );
+				mot &= mot - 1;
+				const uint64_t * masque = masques + (size_t) q * d->nb_mots;
+				for( k=0; k<d->nb_mots; k++ ) espace->mots[k] |= masque[k];
+			}
+		}
+		return d->nb_mots;
+	}
+
+	espace->generation++;
+	if( espace->generation == 0 ){
+		memset( espace->marque, 0, ( g->nb_etats + 1 ) * sizeof(unsigned int) );
+		espace->generation = 1;
+	}
+	int taille = 0;
+	for( i=0; i<nb_mots; i++ ){
+		int c = (int) partie[i] * g->nb_lettres + lettre;
+		reserver_espace_image( espace, taille + g->debut[c+1] - g->debut[c] );
+		for( k = g->debut[c]; k < g->debut[c+1]; k++ ){
+			int q = g->fins[k];
+			if( espace->marque[q] != espace->generation ){
+				espace->marque[q] = espace->generation;
+				espace->mots[ taille++ ] = q;
+			}
+		}
+	}
+	qsort( espace->mots, taille, sizeof(uint64_t), comparer_mots_determinisation );
+	return taille;
+}
+
+int partie_est_finale_determinisation(
+	const Determinisation * d, const uint64_t * partie, int nb_mots
+){
+	int i;
+	if( d->ensembles_de_bits ){
+		for( i=0; i<nb_mots; i++ ){
+			if( partie[i] & d->masque_final[i] ) return 1;
+		}
+	}else{
+		for( i=0; i<nb_mots; i++ ){
+			if( d->graphe->final[ partie[i] ] ) return 1;
+		}
+	}
+	return 0;
+}
+
+/*
+ * Ajoute la partie contenue dans l'espace de calcul et renvoie son numéro.
+ */
+int ajouter_partie_determinisation( Determinisation * d, int nb_mots ){
+	int nouveau;
+	int id = interner_vecteur( d->parties, d->espace->mots, nb_mots, &nouveau );
+	if( ! nouveau ) return id;
+
+	int nb_lettres = d->graphe->nb_lettres;
+	if( id == d->capacite_etats ){
+		d->capacite_etats *= 2;
+		d->transitions = xrealloc(
+			d->transitions,
+			( (size_t) d->capacite_etats * nb_lettres + 1 ) * sizeof(int)
+		);
+		d->final = xrealloc( d->final, d->capacite_etats );
+	}
+	memset( d->transitions + (size_t) id * nb_lettres, -1, nb_lettres * sizeof(int) );
+	d->final[id] = partie_est_finale_determinisation( d, d->espace->mots, nb_mots );
+	return id;
+}
+
+Determinisation * creer_determinisation( const Automate * automate ){
+	Determinisation * d = xmalloc( sizeof(Determinisation) );
+	Graphe * g = creer_graphe( automate );
+	int n = g->nb_etats;
+	int nb_lettres = g->nb_lettres;
+	int i, l, k;
+
+	d->graphe = g;
+	d->nb_mots = NB_MOTS_BITS( n );
+	d->ensembles_de_bits =
+		(size_t) n * nb_lettres * d->nb_mots * sizeof(uint64_t) 
+		<= DETERMINISATION_MAX_MASQUES;
+	d->masques = NULL;
+	d->masque_final = NULL;
+	d->parties = creer_table_vecteurs();
+	d->capacite_etats = 16;
+	d->transitions = xmalloc(
+		( (size_t) d->capacite_etats * nb_lettres + 1 ) * sizeof(int)
+	);
+	d->final = xmalloc( d->capacite_etats );
+
+	if( d->ensembles_de_bits ){
+		size_t taille = (size_t) n * nb_lettres * d->nb_mots;
+		d->masques = xmalloc( ( taille + 1 ) * sizeof(uint64_t) );
+		memset( d->masques, 0, ( taille + 1 ) * sizeof(uint64_t) );
+		for( i=0; i<n; i++ ){
+			for( l=0; l<nb_lettres; l++ ){
+				uint64_t * masque = d->masques + ( (size_t) l * n + i ) * d->nb_mots;
+				int c = i*nb_lettres + l;
+				for( k = g->debut[c]; k < g->debut[c+1]; k++ ){
+					METTRE_BIT( masque, g->fins[k] );
+				}
+			}
+		}
+		d->masque_final = xmalloc( ( d->nb_mots + 1 ) * sizeof(uint64_t) );
+		memset( d->masque_final, 0, ( d->nb_mots + 1 ) * sizeof(uint64_t) );
+		for( i=0; i<n; i++ ){
+			if( g->final[i] ) METTRE_BIT( d->masque_final, i );
+		}
+	}
+
+	d->espace = creer_espace_image( d );
+	ajouter_partie_determinisation( d, partie_initiale_determinisation( d, d->espace ) );
+	return d;
+}
+
+void liberer_determinisation( Determinisation * d ){
+	liberer_espace_image( d->espace );
+	liberer_graphe( d->graphe );
+	xfree( d->masques );
+	xfree( d->masque_final );
+	liberer_table_vecteurs( d->parties );
+	xfree( d->transitions );
+	xfree( d->final );
+	xfree( d );
+}
+
+const Graphe * graphe_determinisation( const Determinisation * d ){
+	return d->graphe;
+}
+
+int nombre_etats_determinisation( const Determinisation * d ){
+	return taille_table_vecteurs( d->parties );
+}
+
+int est_final_determinisation( const Determinisation * d, int etat ){
+	return d->final[etat];
+}
+
+int taille_partie_determinisation( const Determinisation * d, int etat ){
+	int nb_mots;
+	const uint64_t * partie = get_vecteur( d->parties, etat, &nb_mots );
+	if( ! d->ensembles_de_bits ) return nb_mots;
+	int taille = 0;
+	int i;
+	for( i=0; i<nb_mots; i++ ) taille += __builtin_popcountll( partie[i] );
+	return taille;
+}
+
+int successeur_determinisation( Determinisation * d, int etat, int lettre ){
+	int nb_lettres = d->graphe->nb_lettres;
+	int transition = d->transitions[ (size_t) etat * nb_lettres + lettre ];
+	if( transition >= 0 ) return transition;
+
+	int nb_mots;
+	const uint64_t * partie = get_vecteur( d->parties, etat, &nb_mots );
+	int taille = image_partie_determinisation( d, partie, nb_mots, lettre, d->espace );
+	int id = ajouter_partie_determinisation( d, taille );
+	// ajouter_partie_determinisation() peut déplacer le tableau des transitions.
+	d->transitions[ (size_t) etat * nb_lettres + lettre ] = id;
+	return id;
+}
+
+size_t memoire_determinisation( const Determinisation * d ){
+	const Graphe * g = d->graphe;
+	size_t memoire = sizeof(Determinisation) + memoire_table_vecteurs( d->parties )
+		+ (size_t) d->capacite_etats * ( g->nb_lettres * sizeof(int) + 1 )
+		+ d->espace->capacite * sizeof(uint64_t);
+	if( d->ensembles_de_bits ){
+		memoire += ( (size_t) g->nb_etats * g->nb_lettres + 1 ) * d->nb_mots 
+			* sizeof(uint64_t);
+	}else{
+		memoire += g->nb_etats * sizeof(unsigned int);
+	}
+	return memoire;
+}
@@ -0,0 +1,170 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2014, 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file determinisation.h */ 
+
+#ifndef __DETERMINISATION_H__
+#define __DETERMINISATION_H__
+
+#include "automate.h"
+#include "graphe.h"
+
+#include <stdint.h>
+
+/**
+ * @brief Taille maximale, en octets, des masques de successeurs par lettre.
+ *
+ * En deçà, les sous-ensembles d'états sont codés par des ensembles de bits 
+ * et l'image d'un sous-ensemble par une lettre est le ou bit à bit des 
+ * masques de ses éléments. Au-delà, ils sont codés par des tableaux triés 
+ * d'indices d'états.
+ */
+#define DETERMINISATION_MAX_MASQUES ( (size_t) 1 << 25 )
+
+/**
+ * @brief Construction paresseuse de l'automate des parties d'un automate.
+ *
+ * Les états de l'automate des parties sont numérotés à partir de 0 (la 
+ * partie des états initiaux) dans l'ordre de leur découverte. Les lettres 
+ * sont désignées par leur indice dans graphe_determinisation()->lettres.
+ * Les parties sont internées dans une table de hachage (voir vecteurs.h) et
+ * les transitions déjà calculées sont mémorisées.
+ */
+typedef struct Determinisation Determinisation;
+
+/**
+ * @brief Prépare la déterminisation d'un automate.
+ *
+ * La déterminisation est indépendante de l'automate du point de vue de la 
+ * mémoire.
+ *
+ * @param automate L'automate à déterminiser.
+ * @return La déterminisation, dont seul l'état 0 est connu.
+ */
+Determinisation * creer_determinisation( const Automate * automate );
+
+/**
+ * @brief Détruit une déterminisation.
+ */
+void liberer_determinisation( Determinisation * determinisation );
+
+/**
+ * @brief Renvoie l'index d'adjacence de l'automate déterminisé.
+ */
+const Graphe * graphe_determinisation( const Determinisation * determinisation );
+
+/**
+ * @brief Renvoie le nombre d'états découverts.
+ */
+int nombre_etats_determinisation( const Determinisation * determinisation );
+
+/**
+ * @brief Renvoie l'état atteint depuis un état en lisant une lettre, en le 
+ *        créant s'il n'a pas encore été découvert.
+ *
+ * @param determinisation Une déterminisation.
+ * @param etat Un état découvert.
+ * @param lettre L'indice de la lettre.
+ * @return L'état atteint.
+ */
+int successeur_determinisation(
+	Determinisation * determinisation, int etat, int lettre
+);
+
+/**
+ * @brief Renvoie 1 si la partie associée à un état découvert contient un état
+ *        final.
+ */
+int est_final_determinisation(
+	const Determinisation * determinisation, int etat
+);
+
+/**
+ * @brief Renvoie le nombre d'éléments de la partie associée à un état 
+ *        découvert.
+ */
+int taille_partie_determinisation(
+	const Determinisation * determinisation, int etat
+);
+
+/**
+ * @brief Espace de calcul des images de parties.
+ *
+ * Les fonctions qui prennent un espace de calcul en paramètre ne modifient 
+ * pas la déterminisation : plusieurs threads peuvent les appeler en même 
+ * temps, chacun avec son propre espace.
+ */
+typedef struct Espace_image Espace_image;
+
+/**
+ * @brief Crée un espace de calcul pour une déterminisation.
+ */
+Espace_image * creer_espace_image( const Determinisation * determinisation );
+
+/**
+ * @brief Détruit un espace de calcul.
+ */
+void liberer_espace_image( Espace_image * espace );
+
+/**
+ * @brief Renvoie les mots de la dernière partie calculée dans l'espace.
+ *
+ * Le pointeur n'est valide que jusqu'au calcul suivant dans cet espace.
+ */
+const uint64_t * mots_espace_image( const Espace_image * espace );
+
+/**
+ * @brief Calcule dans l'espace la partie des états initiaux.
+ *
+ * @return Le nombre de mots de la partie.
+ */
+int partie_initiale_determinisation(
+	const Determinisation * determinisation, Espace_image * espace
+);
+
+/**
+ * @brief Calcule dans l'espace l'image d'une partie par une lettre.
+ *
+ * @param determinisation Une déterminisation.
+ * @param partie Les mots de la partie.
+ * @param nb_mots Le nombre de mots de la partie.
+ * @param lettre L'indice de la lettre.
+ * @param espace L'espace de calcul.
+ * @return Le nombre de mots de l'image.
+ */
+int image_partie_determinisation(
+	const Determinisation * determinisation, const uint64_t * partie, 
+	int nb_mots, int lettre, Espace_image * espace
+);
+
+/**
+ * @brief Renvoie 1 si une partie contient un état final.
+ */
+int partie_est_finale_determinisation(
+	const Determinisation * determinisation, const uint64_t * partie, 
+	int nb_mots
+);
+
+/**
+ * @brief Renvoie la mémoire occupée par la déterminisation, en octets.
+ */
+size_t memoire_determinisation( const Determinisation * determinisation );
+
+#endif
@@ -0,0 +1,572 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2014, 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "determinisation_externe.h"
+#include "graphe.h"
+#include "outils.h"
+
+#include <errno.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+/*
+ * Les parties sont des ensembles de bits de taille fixe (nb_mots mots de 
+ * 64 bits), comparés octet par octet : l'ordre est arbitraire mais total, 
+ * ce qui suffit pour trier et éliminer les doublons.
+ *
+ * Trois sortes d'enregistrements sont écrits sur disque :
+ * - les candidats d'un niveau : partie, origine, indice de lettre ;
+ * - les parties rencontrées, triées : partie, numéro ;
+ * - la frontière (parties nouvelles du niveau) : partie, numéro.
+ */
+
+#define VERSION_AFDX 1
+
+// Nombre maximal de séquences fusionnées en une passe.
+#define FUSION_EXTERNE_MAX 64
+
+typedef struct {
+	FILE * f;
+	char * nom;
+} Fichier_externe;
+
+typedef struct {
+	const char * repertoire;
+	int compteur;
+	int erreur;               // errno de la première erreur, ou 0.
+	int nb_mots;
+	size_t taille_cle;
+	size_t taille_candidat;   // Clé, origine, lettre.
+	size_t taille_partie;     // Clé, numéro.
+} Contexte_externe;
+
+typedef struct {
+	Fichier_externe * fichier;
+	unsigned char * courant;
+	int fini;
+} Curseur_externe;
+
+void noter_erreur_externe( Contexte_externe * c ){
+	if( ! c->erreur ) c->erreur = errno ? errno : EIO;
+}
+
+Fichier_externe * creer_fichier_externe( Contexte_externe * c ){
+	Fichier_externe * fichier = xmalloc( sizeof(Fichier_externe) );
+	size_t taille = strlen( c->repertoire ) + 64;
+	fichier->nom = xmalloc( taille );
+	snprintf(
+		fichier->nom, taille, "%s/determinisation_%ld_%d.tmp", 
+		c->repertoire, (long) getpid(), c->compteur++
+	);
+	fichier->f = fopen( fichier->nom, "w+b" );
+	if( ! fichier->f ) noter_erreur_externe( c );
+	return fichier;
+}
+
+void supprimer_fichier_externe( Fichier_externe * fichier ){
+	if( ! fichier ) return;
+	if( fichier->f ){
+		fclose( fichier->f );
+		remove( fichier->nom );
+	}
+	xfree( fichier->nom );
+	xfree( fichier );
+}
+
+void ecrire_externe(
+	Contexte_externe * c, const void * donnees, size_t taille, FILE * f
+){
+	if( c->erreur || ! f ) return;
+	if( fwrite( donnees, taille, 1, f ) != 1 ) noter_erreur_externe( c );
+}
+
+void rembobiner_externe( Contexte_externe * c, Fichier_externe * fichier ){
+	if( c->erreur || ! fichier->f ) return;
+	if( fflush( fichier->f ) || fseek( fichier->f, 0, SEEK_SET ) ){
+		noter_erreur_externe( c );
+	}
+}
+
+void avancer_curseur_externe( Curseur_externe * curseur, size_t taille ){
+	if( 
+		! curseur->fichier->f
+		|| fread( curseur->courant, taille, 1, curseur->fichier->f ) != 1 
+	){
+		curseur->fini = 1;
+	}
+}
+
+void ouvrir_curseur_externe(
+	Contexte_externe * c, Curseur_externe * curseur, Fichier_externe * fichier,
+	size_t taille
+){
+	curseur->fichier = fichier;
+	curseur->courant = xmalloc( taille );
+	curseur->fini = 0;
+	rembobiner_externe( c, fichier );
+	avancer_curseur_externe( curseur, taille );
+}
+
+/*
+ * Tas binaire de curseurs, ordonné par enregistrement courant.
+ */
+void tamiser_curseurs_externe(
+	Curseur_externe ** tas, int nb, int i, size_t taille
+){
+	while( 1 ){
+		int min = i;
+		int g = 2*i + 1;
+		int d = 2*i + 2;
+		if( g < nb && memcmp( tas[g]->courant, tas[min]->courant, taille ) < 0 ) min = g;
+		if( d < nb && memcmp( tas[d]->courant, tas[min]->courant, taille ) < 0 ) min = d;
+		if( min == i ) return;
+		Curseur_externe * t = tas[i];
+		tas[i] = tas[min];
+		tas[min] = t;
+		i = min;
+	}
+}
+
+/*
+ * Initialise le tas des curseurs ouverts sur les séquences ; renvoie le 
+ * nombre de curseurs non vides.
+ */
+int construire_tas_externe(
+	Contexte_externe * c, Fichier_externe ** sequences, int nb_sequences,
+	Curseur_externe * curseurs, Curseur_externe ** tas, size_t taille
+){
+	int nb = 0;
+	int i;
+	for( i=0; i<nb_sequences; i++ ){
+		ouvrir_curseur_externe( c, &curseurs[i], sequences[i], taille );
+		if( ! curseurs[i].fini ) tas[nb++] = &curseurs[i];
+	}
+	for( i=nb/2-1; i>=0; i-- ) tamiser_curseurs_externe( tas, nb, i, taille );
+	return nb;
+}
+
+/*
+ * Fait avancer le curseur au sommet du tas ; renvoie la nouvelle taille.
+ */
+int avancer_tas_externe( Curseur_externe ** tas, int nb, size_t taille ){
+	avancer_curseur_externe( tas[0], taille );
+	if( tas[0]->fini ) tas[0] = tas[--nb];
+	tamiser_curseurs_externe( tas, nb, 0, taille );
+	return nb;
+}
+
+/*
+ * Fusionne des séquences triées en une seule, et supprime les séquences.
+ */
+Fichier_externe * fusionner_sequences_externe(
+	Contexte_externe * c, Fichier_externe ** sequences, int nb_sequences,
+	size_t taille
+){
+	Fichier_externe * sortie = creer_fichier_externe( c );
+	Curseur_externe * curseurs = xmalloc( nb_sequences * sizeof(Curseur_externe) );
+	Curseur_externe ** tas = xmalloc( nb_sequences * sizeof(Curseur_externe*) );
+	int nb = construire_tas_externe( c, sequences, nb_sequences, curseurs, tas, taille );
+	while( nb > 0 && ! c->erreur ){
+		ecrire_externe( c, tas[0]->courant, taille, sortie->f );
+		nb = avancer_tas_externe( tas, nb, taille );
+	}
+	int i;
+	for( i=0; i<nb_sequences; i++ ){
+		xfree( curseurs[i].courant );
+		supprimer_fichier_externe( sequences[i] );
+	}
+	xfree( curseurs );
+	xfree( tas );
+	return sortie;
+}
+
+/*
+ * Fusionne les séquences par groupes jusqu'à ce qu'il en reste au plus 
+ * FUSION_EXTERNE_MAX ; renvoie le nouveau nombre de séquences.
+ */
+int reduire_sequences_externe(
+	Contexte_externe * c, Fichier_externe ** sequences, int nb_sequences,
+	size_t taille
+){
+	while( nb_sequences > FUSION_EXTERNE_MAX && ! c->erreur ){
+		int nb = 0;
+		int i;
+		for( i=0; i<nb_sequences; i += FUSION_EXTERNE_MAX ){
+			int k = nb_sequences - i;
+			if( k > FUSION_EXTERNE_MAX ) k = FUSION_EXTERNE_MAX;
+			sequences[nb++] = fusionner_sequences_externe( c, sequences + i, k, taille );
+		}
+		nb_sequences = nb;
+	}
+	return nb_sequences;
+}
+
+/*
+ * Tri par fusion (stable) des indices d'enregistrements de taille fixe.
+ */
+void trier_enregistrements_externe(
+	const unsigned char * base, size_t taille, size_t * indices, 
+	size_t * tampon, size_t nb
+){
+	size_t largeur, i;
+	for( largeur=1; largeur<nb; largeur *= 2 ){
+		for( i=0; i<nb; i += 2*largeur ){
+			size_t milieu = i + largeur < nb ? i + largeur : nb;
+			size_t fin = i + 2*largeur < nb ? i + 2*largeur : nb;
+			size_t g = i, d = milieu, k = i;
+			while( g < milieu && d < fin ){
+				if( memcmp( base + indices[d]*taille, base + indices[g]*taille, taille ) < 0 ){
+					tampon[k++] = indices[d++];
+				}else{
+					tampon[k++] = indices[g++];
+				}
+			}
+			while( g < milieu ) tampon[k++] = indices[g++];
+			while( d < fin ) tampon[k++] = indices[d++];
+		}
+		memcpy( indices, tampon, nb * sizeof(size_t) );
+	}
+}
+
+/*
+ * Trie les candidats en mémoire et les écrit dans une nouvelle séquence.
+ */
+Fichier_externe * ecrire_sequence_externe(
+	Contexte_externe * c, const unsigned char * candidats, size_t nb,
+	size_t * indices, size_t * tampon
+){
+	size_t i;
+	for( i=0; i<nb; i++ ) indices[i] = i;
+	trier_enregistrements_externe( candidats, c->taille_candidat, indices, tampon, nb );
+	Fichier_externe * sequence = creer_fichier_externe( c );
+	for( i=0; i<nb; i++ ){
+		ecrire_externe(
+			c, candidats + indices[i] * c->taille_candidat, c->taille_candidat, 
+			sequence->f
+		);
+	}
+	return sequence;
+}
+
+int partie_finale_externe( const uint64_t * masque_final, const unsigned char * cle, int nb_mots ){
+	uint64_t mot;
+	int i;
+	for( i=0; i<nb_mots; i++ ){
+		memcpy( &mot, cle + i * sizeof(uint64_t), sizeof(uint64_t) );
+		if( mot & masque_final[i] ) return 1;
+	}
+	return 0;
+}
+
+int determiniser_sur_disque(
+	const Automate * automate, const char * fichier, const char * repertoire,
+	size_t memoire_max, Statistiques_determinisation_externe * statistiques
+){
+	Graphe * g = creer_graphe( automate );
+	int n = g->nb_etats;
+	int nb_lettres = g->nb_lettres;
+	int i, l, k;
+
+	Contexte_externe c;
+	c.repertoire = repertoire;
+	c.compteur = 0;
+	c.erreur = 0;
+	c.nb_mots = NB_MOTS_BITS( n ) > 0 ? NB_MOTS_BITS( n ) : 1;
+	c.taille_cle = c.nb_mots * sizeof(uint64_t);
+	c.taille_candidat = c.taille_cle + 2 * sizeof(int32_t);
+	c.taille_partie = c.taille_cle + sizeof(int32_t);
+
+	Statistiques_determinisation_externe stats = { 0, 0, 0, 0 };
+
+	uint64_t * masque_final = xmalloc( c.taille_cle );
+	memset( masque_final, 0, c.taille_cle );
+	for( i=0; i<n; i++ ) if( g->final[i] ) METTRE_BIT( masque_final, i );
+
+	// Tampon des candidats, avec les indices et le tampon du tri.
+	size_t capacite = memoire_max / ( c.taille_candidat + 2 * sizeof(size_t) );
+	if( capacite < (size_t) nb_lettres + 1 ) capacite = nb_lettres + 1;
+	unsigned char * candidats = xmalloc( capacite * c.taille_candidat );
+	size_t * indices = xmalloc( capacite * sizeof(size_t) );
+	size_t * tampon = xmalloc( capacite * sizeof(size_t) );
+	uint64_t * partie = xmalloc( c.taille_cle );
+	uint64_t * image = xmalloc( c.taille_cle );
+	unsigned char * enregistrement = xmalloc( c.taille_candidat );
+
+	FILE * sortie = fopen( fichier, "wb" );
+	Fichier_externe * finaux = creer_fichier_externe( &c );
+	if( ! sortie ) noter_erreur_externe( &c );
+	int32_t entete[5] = { VERSION_AFDX, nb_lettres, 0, 0, 0 };
+	int64_t nb_transitions = 0;
+	ecrire_externe( &c, "AFDX", 4, sortie );
+	ecrire_externe( &c, entete, sizeof(entete), sortie );
+	ecrire_externe( &c, &nb_transitions, sizeof(int64_t), sortie );
+	if( nb_lettres ) ecrire_externe( &c, g->lettres, nb_lettres, sortie );
+
+	// Niveau 0 : la partie des états initiaux, de numéro 0.
+	int32_t nb_etats = 0;
+	int32_t nb_finaux = 0;
+	memset( partie, 0, c.taille_cle );
+	for( i=0; i<g->nb_initiaux; i++ ) METTRE_BIT( partie, g->initiaux[i] );
+	memcpy( enregistrement, partie, c.taille_cle );
+	memcpy( enregistrement + c.taille_cle, &nb_etats, sizeof(int32_t) );
+	Fichier_externe * visites = creer_fichier_externe( &c );
+	Fichier_externe * frontiere = creer_fichier_externe( &c );
+	ecrire_externe( &c, enregistrement, c.taille_partie, visites->f );
+	ecrire_externe( &c, enregistrement, c.taille_partie, frontiere->f );
+	if( partie_finale_externe( masque_final, enregistrement, c.nb_mots ) ){
+		ecrire_externe( &c, &nb_etats, sizeof(int32_t), finaux->f );
+		nb_finaux++;
+	}
+	nb_etats++;
+	long taille_frontiere = 1;
+
+	int capacite_sequences = 16;
+	Fichier_externe ** sequences = 
+		xmalloc( capacite_sequences * sizeof(Fichier_externe*) );
+
+	while( taille_frontiere > 0 && nb_lettres > 0 && ! c.erreur ){
+		stats.nb_niveaux++;
+
+		// Images de la frontière, triées par séquences.
+		int nb_sequences = 0;
+		size_t nb_candidats = 0;
+		Curseur_externe curseur;
+		ouvrir_curseur_externe( &c, &curseur, frontiere, c.taille_partie );
+		while( ! curseur.fini && ! c.erreur ){
+			int32_t origine;
+			memcpy( partie, curseur.courant, c.taille_cle );
+			memcpy( &origine, curseur.courant + c.taille_cle, sizeof(int32_t) );
+			if( nb_candidats + nb_lettres > capacite ){
+				if( nb_sequences == capacite_sequences ){
+					capacite_sequences *= 2;
+					sequences = xrealloc( 
+						sequences, capacite_sequences * sizeof(Fichier_externe*)
+					);
+				}
+				sequences[nb_sequences++] = ecrire_sequence_externe(
+					&c, candidats, nb_candidats, indices, tampon
+				);
+				nb_candidats = 0;
+			}
+			for( l=0; l<nb_lettres; l++ ){
+				memset( image, 0, c.taille_cle );
+				for( i=0; i<c.nb_mots; i++ ){
+					uint64_t mot = partie[i];
+					while( mot ){
+						int q = i*64 + __builtin_ctzll( mot );
+						mot &= mot - 1;
+						int cellule = q*nb_lettres + l;
+						for( k = g->debut[cellule]; k < g->debut[cellule+1]; k++ ){
+							METTRE_BIT( image, g->fins[k] );
+						}
+					}
+				}
+				unsigned char * candidat = candidats + nb_candidats * c.taille_candidat;
+				int32_t lettre = l;
+				memcpy( candidat, image, c.taille_cle );
+				memcpy( candidat + c.taille_cle, &origine, sizeof(int32_t) );
+				memcpy( candidat + c.taille_cle + sizeof(int32_t), &lettre, sizeof(int32_t) );
+				nb_candidats++;
+			}
+			avancer_curseur_externe( &curseur, c.taille_partie );
+		}
+		xfree( curseur.courant );
+		if( nb_candidats > 0 ){
+			if( nb_sequences == capacite_sequences ){
+				capacite_sequences *= 2;
+				sequences = xrealloc( 
+					sequences, capacite_sequences * sizeof(Fichier_externe*)
+				);
+			}
+			sequences[nb_sequences++] = ecrire_sequence_externe(
+				&c, candidats, nb_candidats, indices, tampon
+			);
+		}
+		stats.nb_sequences += nb_sequences;
+		nb_sequences = reduire_sequences_externe( 
+			&c, sequences, nb_sequences, c.taille_candidat
+		);
+
+		// Fusion des séquences avec les parties déjà rencontrées.
+		Fichier_externe * nouvelles_visites = creer_fichier_externe( &c );
+		Fichier_externe * nouvelle_frontiere = creer_fichier_externe( &c );
+		taille_frontiere = 0;
+		Curseur_externe visite;
+		ouvrir_curseur_externe( &c, &visite, visites, c.taille_partie );
+		Curseur_externe * curseurs = xmalloc( nb_sequences * sizeof(Curseur_externe) );
+		Curseur_externe ** tas = xmalloc( nb_sequences * sizeof(Curseur_externe*) );
+		int nb = construire_tas_externe( 
+			&c, sequences, nb_sequences, curseurs, tas, c.taille_candidat
+		);
+		int a_une_cle = 0;
+		int32_t but = -1;
+		while( nb > 0 && ! c.erreur ){
+			const unsigned char * candidat = tas[0]->courant;
+			if( ! a_une_cle || memcmp( candidat, partie, c.taille_cle ) != 0 ){
+				a_une_cle = 1;
+				memcpy( partie, candidat, c.taille_cle );
+				while( 
+					! visite.fini 
+					&& memcmp( visite.courant, candidat, c.taille_cle ) < 0 
+				){
+					ecrire_externe( &c, visite.courant, c.taille_partie, nouvelles_visites->f );
+					avancer_curseur_externe( &visite, c.taille_partie );
+				}
+				if( 
+					! visite.fini 
+					&& memcmp( visite.courant, candidat, c.taille_cle ) == 0 
+				){
+					memcpy( &but, visite.courant + c.taille_cle, sizeof(int32_t) );
+				}else{
+					but = nb_etats++;
+					memcpy( enregistrement, candidat, c.taille_cle );
+					memcpy( enregistrement + c.taille_cle, &but, sizeof(int32_t) );
+					ecrire_externe( &c, enregistrement, c.taille_partie, nouvelles_visites->f );
+					ecrire_externe( &c, enregistrement, c.taille_partie, nouvelle_frontiere->f );
+					taille_frontiere++;
+					if( partie_finale_externe( masque_final, candidat, c.nb_mots ) ){
+						ecrire_externe( &c, &but, sizeof(int32_t), finaux->f );
+						nb_finaux++;
+					}
+				}
+			}
+			int32_t transition[3];
+			memcpy( transition, candidat + c.taille_cle, 2 * sizeof(int32_t) );
+			transition[2] = but;
+			ecrire_externe( &c, transition, sizeof(transition), sortie );
+			nb_transitions++;
+			nb = avancer_tas_externe( tas, nb, c.taille_candidat );
+		}
+		while( ! visite.fini && ! c.erreur ){
+			ecrire_externe( &c, visite.courant, c.taille_partie, nouvelles_visites->f );
+			avancer_curseur_externe( &visite, c.taille_partie );
+		}
+		xfree( visite.courant );
+		for( i=0; i<nb_sequences; i++ ){
+			xfree( curseurs[i].courant );
+			supprimer_fichier_externe( sequences[i] );
+		}
+		xfree( curseurs );
+		xfree( tas );
+		supprimer_fichier_externe( visites );
+		supprimer_fichier_externe( frontiere );
+		visites = nouvelles_visites;
+		frontiere = nouvelle_frontiere;
+	}
+
+	// Les états finaux, puis l'en-tête définitif.
+	Curseur_externe curseur;
+	ouvrir_curseur_externe( &c, &curseur, finaux, sizeof(int32_t) );
+	while( ! curseur.fini && ! c.erreur ){
+		ecrire_externe( &c, curseur.courant, sizeof(int32_t), sortie );
+		avancer_curseur_externe( &curseur, sizeof(int32_t) );
+	}
+	xfree( curseur.courant );
+	entete[2] = nb_etats;
+	entete[3] = nb_finaux;
+	if( sortie && ! c.erreur ){
+		if( fseek( sortie, 4, SEEK_SET ) ) noter_erreur_externe( &c );
+		ecrire_externe( &c, entete, sizeof(entete), sortie );
+		ecrire_externe( &c, &nb_transitions, sizeof(int64_t), sortie );
+	}
+	if( sortie && fclose( sortie ) ) noter_erreur_externe( &c );
+
+	stats.nb_etats = nb_etats;
+	stats.nb_transitions = nb_transitions;
+	if( statistiques ) *statistiques = stats;
+
+	supprimer_fichier_externe( visites );
+	supprimer_fichier_externe( frontiere );
+	supprimer_fichier_externe( finaux );
+	xfree( sequences );
+	xfree( candidats );
+	xfree( indices );
+	xfree( tampon );
+	xfree( partie );
+	xfree( image );
+	xfree( enregistrement );
+	xfree( masque_final );
+	liberer_graphe( g );
+
+	if( c.erreur ){
+		errno = c.erreur;
+		return -1;
+	}
+	return 0;
+}
+
+Automate * charger_automate_sur_disque( const char * fichier ){
+	FILE * f = fopen( fichier, "rb" );
+	if( ! f ) return NULL;
+
+	char magique[4];
+	int32_t entete[5];
+	int64_t nb_transitions;
+	char lettres[256];
+	if( 
+		fread( magique, 4, 1, f ) != 1 || memcmp( magique, "AFDX", 4 ) != 0
+		|| fread( entete, sizeof(entete), 1, f ) != 1
+		|| fread( &nb_transitions, sizeof(int64_t), 1, f ) != 1
+		|| entete[0] != VERSION_AFDX 
+		|| entete[1] < 0 || entete[1] > 256 || entete[2] < 1
+		|| ( entete[1] && fread( lettres, entete[1], 1, f ) != 1 )
+	){
+		fclose( f );
+		return NULL;
+	}
+	int nb_lettres = entete[1];
+	int nb_etats = entete[2];
+	int nb_finaux = entete[3];
+
+	Automate * automate = creer_automate();
+	ajouter_etat_initial( automate, 0 );
+	int ok = 1;
+	int64_t t;
+	for( t=0; t<nb_transitions && ok; t++ ){
+		int32_t transition[3];
+		ok = fread( transition, sizeof(transition), 1, f ) == 1
+			&& transition[0] >= 0 && transition[0] < nb_etats
+			&& transition[1] >= 0 && transition[1] < nb_lettres
+			&& transition[2] >= 0 && transition[2] < nb_etats;
+		if( ok ){
+			ajouter_transition( 
+				automate, transition[0], lettres[ transition[1] ], transition[2] 
+			);
+		}
+	}
+	int i;
+	for( i=0; i<nb_finaux && ok; i++ ){
+		int32_t etat;
+		ok = fread( &etat, sizeof(int32_t), 1, f ) == 1 
+			&& etat >= 0 && etat < nb_etats;
+		if( ok ) ajouter_etat_final( automate, etat );
+	}
+	fclose( f );
+	if( ! ok ){
+		liberer_automate( automate );
+		return NULL;
+	}
+	return automate;
+}
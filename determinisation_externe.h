@@ -0,0 +1,83 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2014, 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file determinisation_externe.h */ 
+
+#ifndef __DETERMINISATION_EXTERNE_H__
+#define __DETERMINISATION_EXTERNE_H__
+
+#include "automate.h"
+
+#include <stddef.h>
+
+/**
+ * @brief Statistiques d'une déterminisation sur disque.
+ */
+typedef struct {
+	long nb_etats;
+	long nb_transitions;
+	int nb_niveaux;         ///< Nombre de niveaux du parcours en largeur.
+	long nb_sequences;      ///< Nombre de séquences triées écrites sur disque.
+} Statistiques_determinisation_externe;
+
+/**
+ * @brief Déterminise un automate en gardant les parties sur disque.
+ *
+ * Les parties sont explorées en largeur, niveau par niveau. Les images des 
+ * parties d'un niveau sont triées par séquences tenant dans la mémoire 
+ * autorisée, écrites dans le répertoire temporaire, puis fusionnées avec 
+ * le fichier trié des parties déjà rencontrées : les doublons sont ainsi 
+ * éliminés sans jamais garder l'ensemble des parties en mémoire. Les 
+ * transitions sont écrites au fur et à mesure dans le fichier résultat.
+ *
+ * Les états de l'automate obtenu sont numérotés de 0 à n-1 dans l'ordre du 
+ * parcours en largeur (et non dans celui de creer_automate_deterministe()) ;
+ * l'état initial est 0. Comme creer_automate_deterministe(), l'automate est 
+ * complet.
+ *
+ * Le format du fichier est : l'en-tête "AFDX", le numéro de version, le 
+ * nombre de lettres, le nombre d'états, le nombre de transitions et le nombre 
+ * d'états finaux, puis les lettres, les transitions (origine, indice de 
+ * lettre, fin) et les états finaux ; les entiers sont écrits en binaire, 
+ * dans le boutisme de la machine.
+ *
+ * @param automate L'automate à déterminiser.
+ * @param fichier Le fichier dans lequel écrire l'automate déterministe.
+ * @param repertoire Le répertoire des fichiers temporaires.
+ * @param memoire_max La mémoire utilisée pour trier les parties, en octets.
+ * @param statistiques Si non NULL, reçoit les statistiques du calcul.
+ * @return 0 en cas de succès, -1 en cas d'erreur d'entrée/sortie (errno 
+ *         indique alors l'erreur).
+ */
+int determiniser_sur_disque(
+	const Automate * automate, const char * fichier, const char * repertoire,
+	size_t memoire_max, Statistiques_determinisation_externe * statistiques
+);
+
+/**
+ * @brief Charge un automate écrit par determiniser_sur_disque().
+ *
+ * @param fichier Le nom du fichier.
+ * @return L'automate, ou NULL si le fichier ne peut pas être lu ou n'est 
+ *         pas au bon format.
+ */
+Automate * charger_automate_sur_disque( const char * fichier );
+
+#endif
@@ -0,0 +1,532 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2014, 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "determinisation_incrementale.h"
+#include "vecteurs.h"
+#include "outils.h"
+#include "ensemble.h"
+
+#include <string.h>
+#include <assert.h>
+
+/*
+ * Les parties sont des tableaux triés d'états de l'automate source (et non 
+ * d'indices), internés dans une table de vecteurs : elles restent valables 
+ * quand des états sont ajoutés.
+ *
+ * L'automate résultat est conservé d'un appel à l'autre : ses états sont les 
+ * numéros des parties atteintes et ses transitions sont recopiées dans 
+ * 'sorties'. Seules les parties signalées par l'observateur (ou nouvellement 
+ * atteintes) sont revues, et seules les lignes qui changent sont retouchées.
+ */
+struct Determinisation_incrementale {
+	Automate * automate;
+	Table_vecteurs * parties;
+	int capacite_parties;
+	int * colonnes[256];        // [lettre][partie], -1 si à calculer ; NULL si lettre absente.
+	char * final;
+
+	Automate * resultat;
+	int initial;                // Partie initiale du résultat, -1 au départ.
+	char lettres[256];          // Lettres du résultat.
+	int nb_lettres;
+	int * sorties[256];         // [lettre][partie], transition du résultat ou -1.
+	char * atteinte;            // La partie est un état du résultat.
+	char * final_sortie;        // La partie est un état final du résultat.
+	char * sale;                // La partie est dans 'sales'.
+	int * sales;                // Parties à revoir au prochain calcul.
+	int nb_sales;
+	long nb_retouches;
+
+	// États de l'automate source (numérotés par une table de vecteurs) et 
+	// parties qui les contiennent.
+	Table_vecteurs * etats;
+	int ** occurrences;
+	int * nb_occurrences;
+	int * capacite_occurrences;
+	int capacite_etats;
+
+	uint64_t * tampon;
+	int capacite_tampon;
+	long nb_images;
+};
+
+int comparer_etats_incrementale( const void * a, const void * b ){
+	uint64_t x = *(const uint64_t*) a;
+	uint64_t y = *(const uint64_t*) b;
+	return (int64_t) x < (int64_t) y ? -1 : (int64_t) x > (int64_t) y;
+}
+
+void reserver_tampon_incrementale( Determinisation_incrementale * d, int taille ){
+	if( taille > d->capacite_tampon ){
+		while( d->capacite_tampon < taille ) d->capacite_tampon *= 2;
+		d->tampon = xrealloc( d->tampon, d->capacite_tampon * sizeof(uint64_t) );
+	}
+}
+
+void ajouter_occurrence_incrementale( 
+	Determinisation_incrementale * d, int64_t etat, int partie 
+){
+	uint64_t cle = etat;
+	int nouveau;
+	int i = interner_vecteur( d->etats, &cle, 1, &nouveau );
+	if( nouveau ){
+		if( i == d->capacite_etats ){
+			d->capacite_etats *= 2;
+			d->occurrences = xrealloc( d->occurrences, d->capacite_etats * sizeof(int*) );
+			d->nb_occurrences = xrealloc( d->nb_occurrences, d->capacite_etats * sizeof(int) );
+			d->capacite_occurrences = 
+				xrealloc( d->capacite_occurrences, d->capacite_etats * sizeof(int) );
+		}
+		d->capacite_occurrences[i] = 4;
+		d->nb_occurrences[i] = 0;
+		d->occurrences[i] = xmalloc( 4 * sizeof(int) );
+	}
+	if( d->nb_occurrences[i] == d->capacite_occurrences[i] ){
+		d->capacite_occurrences[i] *= 2;
+		d->occurrences[i] = 
+			xrealloc( d->occurrences[i], d->capacite_occurrences[i] * sizeof(int) );
+	}
+	d->occurrences[i][ d->nb_occurrences[i]++ ] = partie;
+}
+
+int partie_finale_incrementale( Determinisation_incrementale * d, int partie ){
+	int nb_etats;
+	const uint64_t * etats = get_vecteur( d->parties, partie, &nb_etats );
+	int i;
+	for( i=0; i<nb_etats; i++ ){
+		if( est_un_etat_final_de_l_automate( d->automate, (int64_t) etats[i] ) ){
+			return 1;
+		}
+	}
+	return 0;
+}
+
+void marquer_partie_incrementale( Determinisation_incrementale * d, int partie ){
+	if( d->sale[partie] ) return;
+	d->sale[partie] = 1;
+	d->sales[ d->nb_sales++ ] = partie;
+}
+
+/*
+ * Renvoie le numéro de la partie contenue dans le tampon (triée, sans 
+ * doublon), en l'ajoutant si besoin.
+ */
+int ajouter_partie_incrementale( Determinisation_incrementale * d, int taille ){
+	int nouveau;
+	int id = interner_vecteur( d->parties, d->tampon, taille, &nouveau );
+	if( ! nouveau ) return id;
+
+	int c;
+	if( id == d->capacite_parties ){
+		d->capacite_parties *= 2;
+		for( c=0; c<256; c++ ){
+			if( d->colonnes[c] ){
+				d->colonnes[c] = 
+					xrealloc( d->colonnes[c], d->capacite_parties * sizeof(int) );
+			}
+			if( d->sorties[c] ){
+				d->sorties[c] = 
+					xrealloc( d->sorties[c], d->capacite_parties * sizeof(int) );
+			}
+		}
+		d->final = xrealloc( d->final, d->capacite_parties );
+		d->atteinte = xrealloc( d->atteinte, d->capacite_parties );
+		d->final_sortie = xrealloc( d->final_sortie, d->capacite_parties );
+		d->sale = xrealloc( d->sale, d->capacite_parties );
+		d->sales = xrealloc( d->sales, d->capacite_parties * sizeof(int) );
+	}
+	for( c=0; c<256; c++ ){
+		if( d->colonnes[c] ) d->colonnes[c][id] = -1;
+		if( d->sorties[c] ) d->sorties[c][id] = -1;
+	}
+	d->final[id] = 0;
+	d->atteinte[id] = 0;
+	d->final_sortie[id] = 0;
+	d->sale[id] = 0;
+	// ajouter_occurrence_incrementale() ne touche pas au tampon.
+	int i;
+	for( i=0; i<taille; i++ ){
+		int64_t etat = (int64_t) d->tampon[i];
+		if( est_un_etat_final_de_l_automate( d->automate, etat ) ) d->final[id] = 1;
+		ajouter_occurrence_incrementale( d, etat, id );
+	}
+	return id;
+}
+
+int * colonne_incrementale( Determinisation_incrementale * d, char lettre ){
+	unsigned char c = lettre;
+	if( ! d->colonnes[c] ){
+		d->colonnes[c] = xmalloc( d->capacite_parties * sizeof(int) );
+		memset( d->colonnes[c], -1, d->capacite_parties * sizeof(int) );
+	}
+	return d->colonnes[c];
+}
+
+int successeur_incremental( Determinisation_incrementale * d, int partie, char lettre ){
+	int * colonne = colonne_incrementale( d, lettre );
+	if( colonne[partie] >= 0 ) return colonne[partie];
+
+	d->nb_images++;
+	int nb_etats;
+	const uint64_t * etats = get_vecteur( d->parties, partie, &nb_etats );
+	int taille = 0;
+	int i;
+	for( i=0; i<nb_etats; i++ ){
+		const Ensemble * fins = voisins( d->automate, (int64_t) etats[i], lettre );
+		Ensemble_iterateur it;
+		for(
+			it = premier_iterateur_ensemble( fins );
+			! iterateur_ensemble_est_vide( it );
+			it = iterateur_suivant_ensemble( it )
+		){
+			reserver_tampon_incrementale( d, taille + 1 );
+			d->tampon[ taille++ ] = (int64_t) get_element( it );
+		}
+	}
+	qsort( d->tampon, taille, sizeof(uint64_t), comparer_etats_incrementale );
+	int k = 0;
+	for( i=0; i<taille; i++ ){
+		if( k == 0 || d->tampon[i] != d->tampon[k-1] ) d->tampon[k++] = d->tampon[i];
+	}
+
+	int id = ajouter_partie_incrementale( d, k );
+	// La colonne a pu être déplacée.
+	d->colonnes[ (unsigned char) lettre ][partie] = id;
+	return id;
+}
+
+void observer_determinisation_incrementale(
+	void * data, Modification_automate modification, 
+	int origine, char lettre, int fin
+){
+	Determinisation_incrementale * d = data;
+	uint64_t cle = (int64_t) origine;
+	int i = trouver_vecteur( d->etats, &cle, 1 );
+	if( i < 0 ) return;
+	int k;
+	if( 
+		modification == MODIFICATION_TRANSITION 
+		|| modification == MODIFICATION_RETRAIT_TRANSITION 
+	){
+		int * colonne = d->colonnes[ (unsigned char) lettre ];
+		if( ! colonne ) return;
+		for( k=0; k<d->nb_occurrences[i]; k++ ){
+			colonne[ d->occurrences[i][k] ] = -1;
+			marquer_partie_incrementale( d, d->occurrences[i][k] );
+		}
+	}else{
+		for( k=0; k<d->nb_occurrences[i]; k++ ){
+			int partie = d->occurrences[i][k];
+			if( modification == MODIFICATION_ETAT_FINAL ){
+				d->final[partie] = 1;
+			}else{
+				d->final[partie] = partie_finale_incrementale( d, partie );
+			}
+			marquer_partie_incrementale( d, partie );
+		}
+	}
+}
+
+Determinisation_incrementale * creer_determinisation_incrementale( 
+	Automate * automate 
+){
+	// Un automate n'a qu'un observateur : un second le remplacerait sans 
+	// bruit, et le premier renverrait des résultats périmés.
+	assert( ! automate->observation );
+	Determinisation_incrementale * d = xmalloc( sizeof(Determinisation_incrementale) );
+	d->automate = automate;
+	d->parties = creer_table_vecteurs();
+	d->capacite_parties = 16;
+	memset( d->colonnes, 0, sizeof(d->colonnes) );
+	d->final = xmalloc( d->capacite_parties );
+	d->resultat = creer_automate();
+	d->initial = -1;
+	d->nb_lettres = 0;
+	memset( d->sorties, 0, sizeof(d->sorties) );
+	d->atteinte = xmalloc( d->capacite_parties );
+	d->final_sortie = xmalloc( d->capacite_parties );
+	d->sale = xmalloc( d->capacite_parties );
+	d->sales = xmalloc( d->capacite_parties * sizeof(int) );
+	d->nb_sales = 0;
+	d->nb_retouches = 0;
+	d->etats = creer_table_vecteurs();
+	d->capacite_etats = 16;
+	d->occurrences = xmalloc( d->capacite_etats * sizeof(int*) );
+	d->nb_occurrences = xmalloc( d->capacite_etats * sizeof(int) );
+	d->capacite_occurrences = xmalloc( d->capacite_etats * sizeof(int) );
+	d->capacite_tampon = 16;
+	d->tampon = xmalloc( d->capacite_tampon * sizeof(uint64_t) );
+	d->nb_images = 0;
+	observer_automate( automate, observer_determinisation_incrementale, d );
+	return d;
+}
+
+void liberer_determinisation_incrementale( 
+	Determinisation_incrementale * d 
+){
+	observer_automate( d->automate, NULL, NULL );
+	int i;
+	for( i=0; i<256; i++ ){
+		xfree( d->colonnes[i] );
+		xfree( d->sorties[i] );
+	}
+	for( i=0; i<taille_table_vecteurs( d->etats ); i++ ) xfree( d->occurrences[i] );
+	xfree( d->occurrences );
+	xfree( d->nb_occurrences );
+	xfree( d->capacite_occurrences );
+	liberer_table_vecteurs( d->etats );
+	liberer_table_vecteurs( d->parties );
+	liberer_automate( d->resultat );
+	xfree( d->final );
+	xfree( d->atteinte );
+	xfree( d->final_sortie );
+	xfree( d->sale );
+	xfree( d->sales );
+	xfree( d->tampon );
+	xfree( d );
+}
+
+long nombre_images_calculees( const Determinisation_incrementale * d ){
+	return d->nb_images;
+}
+
+long nombre_retouches_incrementales( const Determinisation_incrementale * d ){
+	return d->nb_retouches;
+}
+
+int nombre_parties_memorisees( const Determinisation_incrementale * d ){
+	return taille_table_vecteurs( d->parties );
+}
+
+void atteindre_partie_incrementale( Determinisation_incrementale * d, int partie ){
+	d->atteinte[partie] = 1;
+	ajouter_etat( d->resultat, partie );
+	marquer_partie_incrementale( d, partie );
+}
+
+/*
+ * Met à jour la finalité et les transitions d'une partie atteinte dans le 
+ * résultat ; 'balayage' passe à 1 si une transition a changé de but.
+ */
+void retoucher_partie_incrementale( 
+	Determinisation_incrementale * d, int partie, int * balayage 
+){
+	if( d->final[partie] != d->final_sortie[partie] ){
+		if( d->final[partie] ){
+			ajouter_etat_final( d->resultat, partie );
+		}else{
+			retirer_etat_final( d->resultat, partie );
+		}
+		d->final_sortie[partie] = d->final[partie];
+		d->nb_retouches++;
+	}
+	int l;
+	for( l=0; l<d->nb_lettres; l++ ){
+		char lettre = d->lettres[l];
+		int but = successeur_incremental( d, partie, lettre );
+		// Les sorties ont pu être déplacées.
+		int * sortie = d->sorties[ (unsigned char) lettre ];
+		if( sortie[partie] == but ) continue;
+		if( sortie[partie] >= 0 ){
+			retirer_transition( d->resultat, partie, lettre, sortie[partie] );
+			*balayage = 1;
+		}
+		ajouter_transition( d->resultat, partie, lettre, but );
+		sortie[partie] = but;
+		d->nb_retouches++;
+		if( ! d->atteinte[but] ) atteindre_partie_incrementale( d, but );
+	}
+}
+
+/*
+ * Retire du résultat les parties qui ne sont plus accessibles depuis la 
+ * partie initiale. Le parcours ne lit que les sorties.
+ */
+void retirer_parties_inaccessibles( Determinisation_incrementale * d ){
+	int n = taille_table_vecteurs( d->parties );
+	char * vu = xmalloc( n );
+	memset( vu, 0, n );
+	int * file = xmalloc( n * sizeof(int) );
+	int debut = 0, fin = 0;
+	vu[ d->initial ] = 1;
+	file[ fin++ ] = d->initial;
+	int l, p;
+	while( debut < fin ){
+		p = file[ debut++ ];
+		for( l=0; l<d->nb_lettres; l++ ){
+			int but = d->sorties[ (unsigned char) d->lettres[l] ][p];
+			if( but >= 0 && ! vu[but] ){
+				vu[but] = 1;
+				file[ fin++ ] = but;
+			}
+		}
+	}
+	// Les transitions d'abord : un état n'est retiré que sans transitions.
+	for( p=0; p<n; p++ ){
+		if( ! d->atteinte[p] || vu[p] ) continue;
+		for( l=0; l<d->nb_lettres; l++ ){
+			char lettre = d->lettres[l];
+			int * sortie = d->sorties[ (unsigned char) lettre ];
+			if( sortie[p] < 0 ) continue;
+			retirer_transition( d->resultat, p, lettre, sortie[p] );
+			sortie[p] = -1;
+			d->nb_retouches++;
+		}
+	}
+	for( p=0; p<n; p++ ){
+		if( ! d->atteinte[p] || vu[p] ) continue;
+		retirer_etat( d->resultat, p );
+		d->atteinte[p] = 0;
+		d->final_sortie[p] = 0;
+	}
+	xfree( vu );
+	xfree( file );
+}
+
+const Automate * automate_deterministe_incremental( Determinisation_incrementale * d ){
+	// La partie initiale est relue à chaque fois : les états initiaux ne 
+	// sont pas observés.
+	const Ensemble * initiaux = get_initiaux( d->automate );
+	reserver_tampon_incrementale( d, taille_ensemble( initiaux ) );
+	int taille = 0;
+	Ensemble_iterateur it;
+	for(
+		it = premier_iterateur_ensemble( initiaux );
+		! iterateur_ensemble_est_vide( it );
+		it = iterateur_suivant_ensemble( it )
+	){
+		d->tampon[ taille++ ] = (int64_t) get_element( it );
+	}
+	int initial = ajouter_partie_incrementale( d, taille );
+
+	// Une nouvelle lettre ajoute une transition à chaque partie atteinte.
+	int nouvelle_lettre = 0;
+	const Ensemble * alphabet = get_alphabet( d->automate );
+	for(
+		it = premier_iterateur_ensemble( alphabet );
+		! iterateur_ensemble_est_vide( it );
+		it = iterateur_suivant_ensemble( it )
+	){
+		char lettre = (char) get_element( it );
+		unsigned char c = lettre;
+		if( d->sorties[c] ) continue;
+		d->sorties[c] = xmalloc( d->capacite_parties * sizeof(int) );
+		memset( d->sorties[c], -1, d->capacite_parties * sizeof(int) );
+		d->lettres[ d->nb_lettres++ ] = lettre;
+		ajouter_lettre( d->resultat, lettre );
+		nouvelle_lettre = 1;
+	}
+	int p;
+	if( nouvelle_lettre ){
+		for( p=0; p<taille_table_vecteurs( d->parties ); p++ ){
+			if( d->atteinte[p] ) marquer_partie_incrementale( d, p );
+		}
+	}
+
+	int balayage = 0;
+	if( initial != d->initial ){
+		if( d->initial >= 0 ){
+			retirer_etat_initial( d->resultat, d->initial );
+			balayage = 1;
+		}
+		d->initial = initial;
+		ajouter_etat_initial( d->resultat, initial );
+		d->nb_retouches++;
+		if( ! d->atteinte[initial] ) atteindre_partie_incrementale( d, initial );
+	}
+
+	while( d->nb_sales > 0 ){
+		p = d->sales[ --d->nb_sales ];
+		d->sale[p] = 0;
+		if( d->atteinte[p] ) retoucher_partie_incrementale( d, p, &balayage );
+	}
+
+	if( balayage ) retirer_parties_inaccessibles( d );
+	return d->resultat;
+}
+
+void compacter_determinisation_incrementale( Determinisation_incrementale * d ){
+	// Après la mise à jour, les parties atteintes sont exactement les 
+	// parties accessibles et aucune partie n'est à revoir.
+	automate_deterministe_incremental( d );
+
+	// Les parties conservées sont renumérotées dans le même ordre : un 
+	// nouveau numéro n'est jamais plus grand que l'ancien, ce qui permet de 
+	// tout déplacer sur place.
+	int n = taille_table_vecteurs( d->parties );
+	int * numero = xmalloc( n * sizeof(int) );
+	Table_vecteurs * parties = creer_table_vecteurs();
+	int p, c, i, k;
+	for( p=0; p<n; p++ ){
+		numero[p] = -1;
+		if( ! d->atteinte[p] ) continue;
+		int nb_etats;
+		const uint64_t * etats = get_vecteur( d->parties, p, &nb_etats );
+		numero[p] = interner_vecteur( parties, etats, nb_etats, NULL );
+	}
+	for( p=0; p<n; p++ ){
+		int q = numero[p];
+		if( q < 0 ) continue;
+		for( c=0; c<256; c++ ){
+			if( d->colonnes[c] ){
+				int but = d->colonnes[c][p];
+				d->colonnes[c][q] = but >= 0 ? numero[but] : -1;
+			}
+			if( d->sorties[c] ){
+				int but = d->sorties[c][p];
+				d->sorties[c][q] = but >= 0 ? numero[but] : -1;
+			}
+		}
+		d->final[q] = d->final[p];
+		d->final_sortie[q] = d->final_sortie[p];
+		d->atteinte[q] = 1;
+		d->sale[q] = 0;
+	}
+	for( i=0; i<taille_table_vecteurs( d->etats ); i++ ){
+		int nb = 0;
+		for( k=0; k<d->nb_occurrences[i]; k++ ){
+			int q = numero[ d->occurrences[i][k] ];
+			if( q >= 0 ) d->occurrences[i][ nb++ ] = q;
+		}
+		d->nb_occurrences[i] = nb;
+	}
+	d->initial = numero[ d->initial ];
+	liberer_table_vecteurs( d->parties );
+	d->parties = parties;
+	xfree( numero );
+
+	// Le résultat est reconstruit avec les nouveaux numéros.
+	liberer_automate( d->resultat );
+	d->resultat = creer_automate();
+	int l;
+	for( l=0; l<d->nb_lettres; l++ ) ajouter_lettre( d->resultat, d->lettres[l] );
+	ajouter_etat_initial( d->resultat, d->initial );
+	for( p=0; p<taille_table_vecteurs( d->parties ); p++ ){
+		ajouter_etat( d->resultat, p );
+		for( l=0; l<d->nb_lettres; l++ ){
+			char lettre = d->lettres[l];
+			ajouter_transition( 
+				d->resultat, p, lettre, d->sorties[ (unsigned char) lettre ][p] 
+			);
+		}
+		if( d->final_sortie[p] ) ajouter_etat_final( d->resultat, p );
+	}
+}
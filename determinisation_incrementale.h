@@ -0,0 +1,126 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2014, 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file determinisation_incrementale.h */ 
+
+#ifndef __DETERMINISATION_INCREMENTALE_H__
+#define __DETERMINISATION_INCREMENTALE_H__
+
+#include "automate.h"
+
+/**
+ * @brief Déterminisation maintenue à jour lors des modifications de 
+ *        l'automate source.
+ *
+ * Les parties rencontrées et leurs transitions sont mémorisées. Quand une 
+ * transition (p, a, q) est ajoutée à l'automate source ou en est retirée, 
+ * seules les transitions par a des parties contenant p sont oubliées ; quand 
+ * p devient final ou cesse de l'être, seules les parties contenant p 
+ * changent. L'automate déterministe est conservé : seules les lignes de ces 
+ * parties sont recalculées et retouchées lors de la mise à jour suivante.
+ *
+ * Les parties qui ne sont plus accessibles sont retirées de l'automate 
+ * déterministe, mais restent mémorisées (avec leurs images) pour le cas où 
+ * elles redeviendraient accessibles : sur un automate source modifié 
+ * longtemps, la mémoire croît avec le nombre de parties rencontrées. 
+ * compacter_determinisation_incrementale() la libère.
+ *
+ * La déterminisation s'installe comme observateur de l'automate source (voir 
+ * observer_automate()) : elle doit être détruite avant lui. Un automate n'a 
+ * qu'un observateur : il ne peut être suivi que par une seule 
+ * déterminisation incrémentale à la fois, et ne doit pas être observé par 
+ * ailleurs.
+ */
+typedef struct Determinisation_incrementale Determinisation_incrementale;
+
+/**
+ * @brief Crée une déterminisation incrémentale liée à un automate.
+ *
+ * L'automate ne doit pas déjà être observé (une assertion le vérifie).
+ */
+Determinisation_incrementale * creer_determinisation_incrementale( 
+	Automate * automate 
+);
+
+/**
+ * @brief Détruit une déterminisation incrémentale et retire son observateur 
+ *        de l'automate source.
+ */
+void liberer_determinisation_incrementale( 
+	Determinisation_incrementale * determinisation 
+);
+
+/**
+ * @brief Renvoie l'automate déterministe de l'automate source dans son état 
+ *        actuel.
+ *
+ * Le résultat est isomorphe à celui de creer_automate_deterministe() sur 
+ * l'automate source ; ses états sont les numéros des parties, qui ne 
+ * changent pas d'un appel à l'autre. Il appartient à la déterminisation : il 
+ * ne doit être ni modifié ni libéré, et il est mis à jour sur place par 
+ * l'appel suivant.
+ *
+ * Un appel coûte le recalcul des images oubliées depuis l'appel précédent et 
+ * la retouche des lignes qui ont changé ; si une transition change de but, 
+ * un parcours des transitions mémorisées (sans accès à l'automate) retire 
+ * les parties devenues inaccessibles. Une nouvelle lettre dans l'automate 
+ * source touche toutes les lignes.
+ */
+const Automate * automate_deterministe_incremental( 
+	Determinisation_incrementale * determinisation 
+);
+
+/**
+ * @brief Oublie les parties qui ne sont pas accessibles dans l'automate 
+ *        déterministe à jour.
+ *
+ * Les parties conservées sont renumérotées et l'automate déterministe est 
+ * reconstruit : le pointeur renvoyé par automate_deterministe_incremental() 
+ * n'est plus valide. Les images des parties conservées restent mémorisées, 
+ * sauf celles qui menaient à une partie oubliée.
+ */
+void compacter_determinisation_incrementale( 
+	Determinisation_incrementale * determinisation 
+);
+
+/**
+ * @brief Renvoie le nombre de parties mémorisées, accessibles ou non.
+ */
+int nombre_parties_memorisees( 
+	const Determinisation_incrementale * determinisation 
+);
+
+/**
+ * @brief Renvoie le nombre de retouches (transitions, états initiaux et 
+ *        finaux ajoutés ou retirés) faites à l'automate déterministe depuis 
+ *        la création.
+ */
+long nombre_retouches_incrementales( 
+	const Determinisation_incrementale * determinisation 
+);
+
+/**
+ * @brief Renvoie le nombre d'images de parties calculées depuis la création.
+ */
+long nombre_images_calculees( 
+	const Determinisation_incrementale * determinisation 
+);
+
+#endif
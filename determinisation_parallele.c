@@ -0,0 +1,243 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2014, 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "automate.h"
+#include "determinisation.h"
+#include "concurrent.h"
+#include "graphe.h"
+#include "outils.h"
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*
+ * Déterminisation parallèle.
+ *
+ * Chaque thread dépile une partie de sa file de travail (ou en vole une à 
+ * un autre thread), calcule ses images par toutes les lettres et les 
+ * interne dans une table concurrente ; les parties nouvelles sont ajoutées 
+ * à sa file. Les transitions sont notées dans des tampons propres à chaque 
+ * thread. Une fois l'exploration terminée, les états sont renumérotés en 
+ * rejouant le parcours en profondeur de creer_automate_deterministe() : le 
+ * résultat ne dépend ni du nombre de threads, ni de l'ordonnancement.
+ */
+
+typedef struct {
+	const Determinisation * determinisation;
+	Table_vecteurs_concurrente * parties;
+	File_de_travail ** files;
+	int nb_threads;
+	atomic_long en_attente;   // Parties découvertes mais pas encore traitées.
+} Exploration_parallele;
+
+typedef struct {
+	Exploration_parallele * exploration;
+	int numero;
+	pthread_t thread;
+	// Pour chaque partie traitée : son numéro, son caractère final, puis 
+	// ses successeurs par chaque lettre.
+	int * releves;
+	size_t nb_releves;
+	size_t capacite_releves;
+} Ouvrier_determinisation;
+
+int trouver_travail_determinisation( Ouvrier_determinisation * ouvrier, int * tache ){
+	Exploration_parallele * e = ouvrier->exploration;
+	if( prendre_travail( e->files[ouvrier->numero], tache ) ) return 1;
+	int i;
+	for( i=1; i<e->nb_threads; i++ ){
+		if( voler_travail( e->files[ ( ouvrier->numero + i ) % e->nb_threads ], tache ) ){
+			return 1;
+		}
+	}
+	return 0;
+}
+
+void * travailler_determinisation( void * argument ){
+	Ouvrier_determinisation * ouvrier = argument;
+	Exploration_parallele * e = ouvrier->exploration;
+	const Determinisation * d = e->determinisation;
+	int nb_lettres = graphe_determinisation( d )->nb_lettres;
+	Espace_image * espace = creer_espace_image( d );
+	int capacite = 16;
+	uint64_t * partie = xmalloc( capacite * sizeof(uint64_t) );
+
+	while( 1 ){
+		int etat;
+		if( ! trouver_travail_determinisation( ouvrier, &etat ) ){
+			if( atomic_load( &e->en_attente ) == 0 ) break;
+			sched_yield();
+			continue;
+		}
+		int nb_mots = copier_vecteur_concurrent( e->parties, etat, &partie, &capacite );
+
+		if( ouvrier->nb_releves + nb_lettres + 2 > ouvrier->capacite_releves ){
+			while( ouvrier->nb_releves + nb_lettres + 2 > ouvrier->capacite_releves ){
+				ouvrier->capacite_releves *= 2;
+			}
+			ouvrier->releves = xrealloc(
+				ouvrier->releves, ouvrier->capacite_releves * sizeof(int)
+			);
+		}
+		int * releve = ouvrier->releves + ouvrier->nb_releves;
+		ouvrier->nb_releves += nb_lettres + 2;
+		releve[0] = etat;
+		releve[1] = partie_est_finale_determinisation( d, partie, nb_mots );
+
+		int l;
+		for( l=0; l<nb_lettres; l++ ){
+			int taille = image_partie_determinisation( d, partie, nb_mots, l, espace );
+			int nouveau;
+			int id = interner_vecteur_concurrent(
+				e->parties, mots_espace_image( espace ), taille, &nouveau
+			);
+			if( nouveau ){
+				// Le compteur est incrémenté avant que la partie ne soit 
+				// visible : il ne peut pas tomber à 0 trop tôt.
+				atomic_fetch_add( &e->en_attente, 1 );
+				pousser_travail( e->files[ouvrier->numero], id );
+			}
+			releve[ 2 + l ] = id;
+		}
+		atomic_fetch_sub( &e->en_attente, 1 );
+	}
+
+	xfree( partie );
+	liberer_espace_image( espace );
+	return NULL;
+}
+
+Automate * creer_automate_deterministe_parallele(
+	const Automate* automate, int nb_threads
+){
+	if( nb_threads < 1 ) nb_threads = 1;
+	Determinisation * d = creer_determinisation( automate );
+	const Graphe * g = graphe_determinisation( d );
+	int nb_lettres = g->nb_lettres;
+	int i, l;
+
+	Exploration_parallele e;
+	e.determinisation = d;
+	e.parties = creer_table_vecteurs_concurrente( 4 * nb_threads );
+	e.nb_threads = nb_threads;
+	e.files = xmalloc( nb_threads * sizeof(File_de_travail*) );
+	for( i=0; i<nb_threads; i++ ) e.files[i] = creer_file_de_travail();
+
+	Espace_image * espace = creer_espace_image( d );
+	int taille = partie_initiale_determinisation( d, espace );
+	int initial = interner_vecteur_concurrent(
+		e.parties, mots_espace_image( espace ), taille, NULL
+	);
+	liberer_espace_image( espace );
+	atomic_init( &e.en_attente, 1 );
+	pousser_travail( e.files[0], initial );
+
+	Ouvrier_determinisation * ouvriers = 
+		xmalloc( nb_threads * sizeof(Ouvrier_determinisation) );
+	for( i=0; i<nb_threads; i++ ){
+		ouvriers[i].exploration = &e;
+		ouvriers[i].numero = i;
+		ouvriers[i].capacite_releves = 64;
+		ouvriers[i].nb_releves = 0;
+		ouvriers[i].releves = xmalloc( ouvriers[i].capacite_releves * sizeof(int) );
+	}
+	for( i=1; i<nb_threads; i++ ){
+		if( pthread_create(
+			&ouvriers[i].thread, NULL, travailler_determinisation, &ouvriers[i]
+		) ){
+			perror( "pthread_create" );
+			exit( EXIT_FAILURE );
+		}
+	}
+	travailler_determinisation( &ouvriers[0] );
+	for( i=1; i<nb_threads; i++ ) pthread_join( ouvriers[i].thread, NULL );
+
+	// Numérotation compacte : les sous-tables sont mises bout à bout.
+	int nb_sous_tables = nb_sous_tables_vecteurs( e.parties );
+	int decalage = 0;
+	while( ( 1 << decalage ) < nb_sous_tables ) decalage++;
+	int * debut_sous_table = xmalloc( ( nb_sous_tables + 1 ) * sizeof(int) );
+	debut_sous_table[0] = 0;
+	for( i=0; i<nb_sous_tables; i++ ){
+		debut_sous_table[i+1] = 
+			debut_sous_table[i] + taille_sous_table_vecteurs( e.parties, i );
+	}
+	int nb_etats = debut_sous_table[nb_sous_tables];
+	#define COMPACT( id ) \
+		( debut_sous_table[ (id) & ( nb_sous_tables - 1 ) ] + ( (id) >> decalage ) )
+
+	int * transitions = xmalloc( ( (size_t) nb_etats * nb_lettres + 1 ) * sizeof(int) );
+	char * final = xmalloc( nb_etats + 1 );
+	for( i=0; i<nb_threads; i++ ){
+		size_t k;
+		for( k=0; k<ouvriers[i].nb_releves; k += nb_lettres + 2 ){
+			const int * releve = ouvriers[i].releves + k;
+			int etat = COMPACT( releve[0] );
+			final[etat] = releve[1];
+			for( l=0; l<nb_lettres; l++ ){
+				transitions[ (size_t) etat * nb_lettres + l ] = COMPACT( releve[ 2 + l ] );
+			}
+		}
+		xfree( ouvriers[i].releves );
+	}
+	initial = COMPACT( initial );
+	#undef COMPACT
+
+	// Renumérotation dans l'ordre de creer_automate_deterministe().
+	Automate * res = creer_automate();
+	int * numero = xmalloc( ( nb_etats + 1 ) * sizeof(int) );
+	int * pile = xmalloc( ( nb_etats + 1 ) * sizeof(int) );
+	int sommet = 0;
+	int nb_numeros = 0;
+	for( i=0; i<nb_etats; i++ ) numero[i] = -1;
+
+	numero[initial] = nb_numeros++;
+	ajouter_etat_initial( res, numero[initial] );
+	pile[sommet++] = initial;
+	while( sommet > 0 ){
+		int etat = pile[--sommet];
+		for( l=0; l<nb_lettres; l++ ){
+			int but = transitions[ (size_t) etat * nb_lettres + l ];
+			if( numero[but] < 0 ){
+				numero[but] = nb_numeros++;
+				ajouter_etat( res, numero[but] );
+				pile[sommet++] = but;
+			}
+			ajouter_transition( res, numero[etat], g->lettres[l], numero[but] );
+		}
+		if( final[etat] ) ajouter_etat_final( res, numero[etat] );
+	}
+
+	xfree( pile );
+	xfree( numero );
+	xfree( transitions );
+	xfree( final );
+	xfree( debut_sous_table );
+	xfree( ouvriers );
+	for( i=0; i<nb_threads; i++ ) liberer_file_de_travail( e.files[i] );
+	xfree( e.files );
+	liberer_table_vecteurs_concurrente( e.parties );
+	liberer_determinisation( d );
+	return res;
+}
@@ -0,0 +1,560 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2014, 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "dictionnaire.h"
+#include "automate.h"
+#include "table.h"
+#include "outils.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+/*
+ * Un état du chemin du dernier mot ajouté. Ses fils sont triés par lettre ;
+ * tous sont des états déjà enregistrés, sauf le dernier qui est l'état 
+ * suivant du chemin (son numéro vaut -1 tant qu'il n'est pas enregistré).
+ */
+typedef struct Etat_chemin {
+	int final;
+	int nb_fils;
+	int capacite;
+	char * lettres;
+	int * fils;
+} Etat_chemin;
+
+/*
+ * La signature d'un état enregistré : deux états de même signature 
+ * reconnaissent le même langage.
+ */
+typedef struct Signature {
+	int final;
+	int nb_fils;
+	char * lettres;
+	int * fils;
+} Signature;
+
+struct Dictionnaire {
+	Automate * automate;
+	Table * registre;
+	Etat_chemin * chemin;
+	int longueur_chemin;
+	int capacite_chemin;
+	char * dernier_mot;
+	int prochain_etat;
+	int termine;
+};
+
+int comparer_signature( const Signature * a, const Signature * b ){
+	if( a->final != b->final ) return a->final < b->final ? -1 : 1;
+	if( a->nb_fils != b->nb_fils ) return a->nb_fils < b->nb_fils ? -1 : 1;
+	int i;
+	for( i=0; i<a->nb_fils; i++ ){
+		if( a->lettres[i] != b->lettres[i] ){
+			return (unsigned char) a->lettres[i] < (unsigned char) b->lettres[i] ? -1 : 1;
+		}
+		if( a->fils[i] != b->fils[i] ) return a->fils[i] < b->fils[i] ? -1 : 1;
+	}
+	return 0;
+}
+
+Signature * copier_signature( const Signature * signature ){
+	Signature * res = xmalloc( sizeof(Signature) );
+	res->final = signature->final;
+	res->nb_fils = signature->nb_fils;
+	res->lettres = xmalloc( signature->nb_fils * sizeof(char) + 1 );
+	res->fils = xmalloc( signature->nb_fils * sizeof(int) + 1 );
+	// Les feuilles n'ont pas de tableaux : memcpy() depuis NULL est indéfini.
+	if( signature->nb_fils > 0 ){
+		memcpy( res->lettres, signature->lettres, signature->nb_fils * sizeof(char) );
+		memcpy( res->fils, signature->fils, signature->nb_fils * sizeof(int) );
+	}
+	return res;
+}
+
+void supprimer_signature( Signature * signature ){
+	xfree( signature->lettres );
+	xfree( signature->fils );
+	xfree( signature );
+}
+
+void initialiser_etat_chemin( Etat_chemin * etat ){
+	etat->final = 0;
+	etat->nb_fils = 0;
+}
+
+void ajouter_fils_etat_chemin( Etat_chemin * etat, char lettre ){
+	if( etat->nb_fils == etat->capacite ){
+		etat->capacite = etat->capacite ? 2*etat->capacite : 2;
+		etat->lettres = xrealloc( etat->lettres, etat->capacite * sizeof(char) );
+		etat->fils = xrealloc( etat->fils, etat->capacite * sizeof(int) );
+	}
+	etat->lettres[ etat->nb_fils ] = lettre;
+	etat->fils[ etat->nb_fils ] = -1;
+	etat->nb_fils++;
+}
+
+void agrandir_chemin( Dictionnaire * dictionnaire, int longueur ){
+	if( longueur <= dictionnaire->capacite_chemin ) return;
+	int capacite = dictionnaire->capacite_chemin;
+	while( capacite < longueur ) capacite *= 2;
+	dictionnaire->chemin = xrealloc(
+		dictionnaire->chemin, capacite * sizeof(Etat_chemin)
+	);
+	memset(
+		dictionnaire->chemin + dictionnaire->capacite_chemin, 0,
+		( capacite - dictionnaire->capacite_chemin ) * sizeof(Etat_chemin)
+	);
+	dictionnaire->capacite_chemin = capacite;
+}
+
+Dictionnaire * creer_dictionnaire(){
+	Dictionnaire * res = xmalloc( sizeof(Dictionnaire) );
+	res->automate = creer_automate();
+	res->registre = creer_table(
+		( int(*)(const intptr_t, const intptr_t) ) comparer_signature,
+		( intptr_t (*)( const intptr_t ) ) copier_signature,
+		( void(*)(intptr_t) ) supprimer_signature
+	);
+	res->capacite_chemin = 16;
+	res->chemin = xmalloc( res->capacite_chemin * sizeof(Etat_chemin) );
+	memset( res->chemin, 0, res->capacite_chemin * sizeof(Etat_chemin) );
+	res->longueur_chemin = 1;
+	res->dernier_mot = NULL;
+	res->prochain_etat = 0;
+	res->termine = 0;
+	return res;
+}
+
+void liberer_dictionnaire( Dictionnaire * dictionnaire ){
+	int i;
+	for( i=0; i<dictionnaire->capacite_chemin; i++ ){
+		xfree( dictionnaire->chemin[i].lettres );
+		xfree( dictionnaire->chemin[i].fils );
+	}
+	xfree( dictionnaire->chemin );
+	liberer_table( dictionnaire->registre );
+	if( dictionnaire->automate ) liberer_automate( dictionnaire->automate );
+	xfree( dictionnaire->dernier_mot );
+	xfree( dictionnaire );
+}
+
+/*
+ * Renvoie le numéro de l'état enregistré équivalent à l'état du chemin passé 
+ * en paramètre. Si aucun état équivalent n'existe, l'état est ajouté à 
+ * l'automate et au registre.
+ */
+int enregistrer_etat_chemin( Dictionnaire * dictionnaire, Etat_chemin * etat ){
+	Signature signature;
+	signature.final = etat->final;
+	signature.nb_fils = etat->nb_fils;
+	signature.lettres = etat->lettres;
+	signature.fils = etat->fils;
+
+	Table_iterateur it = trouver_table(
+		dictionnaire->registre, (intptr_t) &signature
+	);
+	if( ! iterateur_est_vide( it ) ){
+		return (int) get_valeur( it );
+	}
+
+	int id = dictionnaire->prochain_etat++;
+	ajouter_etat( dictionnaire->automate, id );
+	if( etat->final ){
+		ajouter_etat_final( dictionnaire->automate, id );
+	}
+	int i;
+	for( i=0; i<etat->nb_fils; i++ ){
+		ajouter_transition(
+			dictionnaire->automate, id, etat->lettres[i], etat->fils[i]
+		);
+	}
+	add_table( dictionnaire->registre, (intptr_t) &signature, id );
+	return id;
+}
+
+/*
+ * Enregistre les états du chemin de profondeur strictement supérieure à 
+ * 'profondeur'.
+ */
+void minimiser_chemin( Dictionnaire * dictionnaire, int profondeur ){
+	int i;
+	for( i = dictionnaire->longueur_chemin - 1; i > profondeur; i-- ){
+		Etat_chemin * pere = &dictionnaire->chemin[i-1];
+		pere->fils[ pere->nb_fils-1 ] = enregistrer_etat_chemin(
+			dictionnaire, &dictionnaire->chemin[i]
+		);
+	}
+	dictionnaire->longueur_chemin = profondeur + 1;
+}
+
+int ajouter_mot_dictionnaire( Dictionnaire * dictionnaire, const char * mot ){
+	if( dictionnaire->termine ) return 0;
+
+	int prefixe = 0;
+	if( dictionnaire->dernier_mot ){
+		int cmp = strcmp( mot, dictionnaire->dernier_mot );
+		if( cmp < 0 ) return 0;
+		if( cmp == 0 ) return 1;
+		while( mot[prefixe] && mot[prefixe] == dictionnaire->dernier_mot[prefixe] ){
+			prefixe++;
+		}
+	}
+
+	minimiser_chemin( dictionnaire, prefixe );
+
+	int len = strlen( mot );
+	agrandir_chemin( dictionnaire, len+1 );
+	int i;
+	for( i=prefixe; i<len; i++ ){
+		ajouter_fils_etat_chemin( &dictionnaire->chemin[i], mot[i] );
+		initialiser_etat_chemin( &dictionnaire->chemin[i+1] );
+	}
+	dictionnaire->chemin[len].final = 1;
+	dictionnaire->longueur_chemin = len+1;
+
+	xfree( dictionnaire->dernier_mot );
+	dictionnaire->dernier_mot = xmalloc( len+1 );
+	memcpy( dictionnaire->dernier_mot, mot, len+1 );
+	return 1;
+}
+
+Automate * terminer_dictionnaire( Dictionnaire * dictionnaire ){
+	if( dictionnaire->termine ) return NULL;
+	minimiser_chemin( dictionnaire, 0 );
+	int racine = enregistrer_etat_chemin( dictionnaire, &dictionnaire->chemin[0] );
+	ajouter_etat_initial( dictionnaire->automate, racine );
+	dictionnaire->termine = 1;
+
+	Automate * res = dictionnaire->automate;
+	dictionnaire->automate = NULL;
+	return res;
+}
+
+Automate * creer_automate_dictionnaire( const char ** mots, int nb_mots ){
+	Dictionnaire * dictionnaire = creer_dictionnaire();
+	int i;
+	for( i=0; i<nb_mots; i++ ){
+		if( ! ajouter_mot_dictionnaire( dictionnaire, mots[i] ) ){
+			liberer_dictionnaire( dictionnaire );
+			return NULL;
+		}
+	}
+	Automate * res = terminer_dictionnaire( dictionnaire );
+	liberer_dictionnaire( dictionnaire );
+	return res;
+}
+
+struct Index_mots {
+	int nb_etats;
+	int initial;
+	int hauteur;
+	char * final;
+	int * debut;
+	char * lettres;
+	int * cibles;
+	long * nb_suffixes;
+};
+
+typedef struct Transition_index {
+	int origine;
+	char lettre;
+	int fin;
+} Transition_index;
+
+typedef struct Collecte_transitions_index {
+	const int * etats;
+	int nb_etats;
+	Transition_index * transitions;
+	int nb_transitions;
+} Collecte_transitions_index;
+
+int comparer_entiers_index( const void * a, const void * b ){
+	int x = *(const int*) a;
+	int y = *(const int*) b;
+	return ( x > y ) - ( x < y );
+}
+
+int indice_etat_index( const int * etats, int nb_etats, int etat ){
+	const int * res = bsearch(
+		&etat, etats, nb_etats, sizeof(int), comparer_entiers_index
+	);
+	return res ? (int) ( res - etats ) : -1;
+}
+
+int comparer_transitions_index( const void * a, const void * b ){
+	const Transition_index * t1 = a;
+	const Transition_index * t2 = b;
+	if( t1->origine != t2->origine ) return t1->origine < t2->origine ? -1 : 1;
+	if( t1->lettre != t2->lettre ){
+		return (unsigned char) t1->lettre < (unsigned char) t2->lettre ? -1 : 1;
+	}
+	return ( t1->fin > t2->fin ) - ( t1->fin < t2->fin );
+}
+
+void action_collecter_transitions_index(
+	int origine, char lettre, int fin, void* data
+){
+	Collecte_transitions_index * collecte = (Collecte_transitions_index*) data;
+	Transition_index * t = &collecte->transitions[ collecte->nb_transitions++ ];
+	t->origine = indice_etat_index( collecte->etats, collecte->nb_etats, origine );
+	t->lettre = lettre;
+	t->fin = indice_etat_index( collecte->etats, collecte->nb_etats, fin );
+}
+
+/*
+ * Marque les états depuis lesquels un état final est accessible.
+ */
+char * etats_utiles_index( const Index_mots * index ){
+	int n = index->nb_etats;
+	int m = index->debut[n];
+	int * debut_inverse = xmalloc( ( n + 1 ) * sizeof(int) );
+	int * origines = xmalloc( ( m + 1 ) * sizeof(int) );
+	int * pile = xmalloc( ( n + 1 ) * sizeof(int) );
+	char * utile = xmalloc( n + 1 );
+	memset( debut_inverse, 0, ( n + 1 ) * sizeof(int) );
+	memset( utile, 0, n + 1 );
+	int i, etat;
+	for( i=0; i<m; i++ ) debut_inverse[ index->cibles[i] + 1 ]++;
+	for( i=0; i<n; i++ ) debut_inverse[i+1] += debut_inverse[i];
+	int * position = xmalloc( ( n + 1 ) * sizeof(int) );
+	memcpy( position, debut_inverse, ( n + 1 ) * sizeof(int) );
+	for( etat=0; etat<n; etat++ ){
+		for( i = index->debut[etat]; i < index->debut[etat+1]; i++ ){
+			origines[ position[ index->cibles[i] ]++ ] = etat;
+		}
+	}
+	xfree( position );
+
+	int sommet = 0;
+	for( etat=0; etat<n; etat++ ){
+		if( index->final[etat] ){
+			utile[etat] = 1;
+			pile[sommet++] = etat;
+		}
+	}
+	while( sommet > 0 ){
+		etat = pile[--sommet];
+		for( i = debut_inverse[etat]; i < debut_inverse[etat+1]; i++ ){
+			if( ! utile[ origines[i] ] ){
+				utile[ origines[i] ] = 1;
+				pile[sommet++] = origines[i];
+			}
+		}
+	}
+
+	xfree( pile );
+	xfree( origines );
+	xfree( debut_inverse );
+	return utile;
+}
+
+/*
+ * Calcule, par un parcours en profondeur itératif depuis l'état initial, le 
+ * nombre de suffixes acceptés et la hauteur de chaque état accessible.
+ * Les états depuis lesquels aucun état final n'est accessible (comme l'état 
+ * puits d'un automate complet) sont ignorés.
+ * Renvoie 0 si un cycle accessible et co-accessible existe.
+ */
+int calculer_nb_suffixes_index( Index_mots * index, int * hauteurs ){
+	int n = index->nb_etats;
+	char * utile = etats_utiles_index( index );
+	char * couleur = xmalloc( n + 1 );
+	int * pile = xmalloc( ( n + 1 ) * sizeof(int) );
+	int * prochain = xmalloc( ( n + 1 ) * sizeof(int) );
+	memset( couleur, 0, n + 1 );
+	memset( hauteurs, 0, ( n + 1 ) * sizeof(int) );
+	int sommet = 0;
+	int acyclique = 1;
+
+	pile[sommet++] = index->initial;
+	couleur[ index->initial ] = 1;
+	prochain[ index->initial ] = index->debut[ index->initial ];
+	while( sommet > 0 && acyclique ){
+		int etat = pile[sommet-1];
+		if( prochain[etat] < index->debut[etat+1] ){
+			int fils = index->cibles[ prochain[etat]++ ];
+			if( ! utile[fils] ){
+				continue;
+			}else if( couleur[fils] == 1 ){
+				acyclique = 0;
+			}else if( couleur[fils] == 0 ){
+				couleur[fils] = 1;
+				prochain[fils] = index->debut[fils];
+				pile[sommet++] = fils;
+			}
+			continue;
+		}
+		long nb = index->final[etat] ? 1 : 0;
+		int hauteur = 0;
+		int i;
+		for( i = index->debut[etat]; i < index->debut[etat+1]; i++ ){
+			int fils = index->cibles[i];
+			nb += index->nb_suffixes[fils];
+			if( hauteurs[fils] + 1 > hauteur ) hauteur = hauteurs[fils] + 1;
+		}
+		index->nb_suffixes[etat] = nb;
+		hauteurs[etat] = hauteur;
+		couleur[etat] = 2;
+		sommet--;
+	}
+
+	xfree( prochain );
+	xfree( pile );
+	xfree( couleur );
+	xfree( utile );
+	return acyclique;
+}
+
+Index_mots * creer_index_mots( const Automate * automate ){
+	if( taille_ensemble( get_initiaux( automate ) ) > 1 ) return NULL;
+
+	Index_mots * index = xmalloc( sizeof(Index_mots) );
+	int n = taille_ensemble( get_etats( automate ) );
+	int * etats = xmalloc( ( n + 1 ) * sizeof(int) );
+	int i = 0;
+	Ensemble_iterateur it;
+	for(
+		it = premier_iterateur_ensemble( get_etats( automate ) );
+		! iterateur_ensemble_est_vide( it );
+		it = iterateur_suivant_ensemble( it )
+	){
+		etats[i++] = get_element( it );
+	}
+
+	Collecte_transitions_index collecte;
+	collecte.etats = etats;
+	collecte.nb_etats = n;
+	collecte.nb_transitions = 0;
+	collecte.transitions = xmalloc(
+		( nombre_de_transitions( automate ) + 1 ) * sizeof(Transition_index)
+	);
+	pour_toute_transition(
+		automate, action_collecter_transitions_index, &collecte
+	);
+	int m = collecte.nb_transitions;
+	qsort( collecte.transitions, m, sizeof(Transition_index), comparer_transitions_index );
+
+	index->nb_etats = n;
+	index->final = xmalloc( n + 1 );
+	index->debut = xmalloc( ( n + 1 ) * sizeof(int) );
+	index->lettres = xmalloc( m + 1 );
+	index->cibles = xmalloc( ( m + 1 ) * sizeof(int) );
+	index->nb_suffixes = xmalloc( ( n + 1 ) * sizeof(long) );
+	memset( index->debut, 0, ( n + 1 ) * sizeof(int) );
+	memset( index->nb_suffixes, 0, ( n + 1 ) * sizeof(long) );
+
+	int deterministe = 1;
+	for( i=0; i<m; i++ ){
+		Transition_index * t = &collecte.transitions[i];
+		if(
+			i > 0 && t->origine == t[-1].origine && t->lettre == t[-1].lettre
+		){
+			deterministe = 0;
+		}
+		index->debut[ t->origine + 1 ]++;
+		index->lettres[i] = t->lettre;
+		index->cibles[i] = t->fin;
+	}
+	for( i=0; i<n; i++ ){
+		index->debut[i+1] += index->debut[i];
+		index->final[i] = est_un_etat_final_de_l_automate( automate, etats[i] );
+	}
+	xfree( collecte.transitions );
+
+	index->initial = -1;
+	index->hauteur = 0;
+	int valide = deterministe;
+	if( valide && taille_ensemble( get_initiaux( automate ) ) == 1 ){
+		it = premier_iterateur_ensemble( get_initiaux( automate ) );
+		index->initial = indice_etat_index( etats, n, get_element( it ) );
+		int * hauteurs = xmalloc( ( n + 1 ) * sizeof(int) );
+		valide = calculer_nb_suffixes_index( index, hauteurs );
+		index->hauteur = hauteurs[ index->initial ];
+		xfree( hauteurs );
+	}
+	xfree( etats );
+
+	if( ! valide ){
+		liberer_index_mots( index );
+		return NULL;
+	}
+	return index;
+}
+
+void liberer_index_mots( Index_mots * index ){
+	xfree( index->final );
+	xfree( index->debut );
+	xfree( index->lettres );
+	xfree( index->cibles );
+	xfree( index->nb_suffixes );
+	xfree( index );
+}
+
+long nombre_de_mots_index( const Index_mots * index ){
+	if( index->initial < 0 ) return 0;
+	return index->nb_suffixes[ index->initial ];
+}
+
+long numero_du_mot( const Index_mots * index, const char * mot ){
+	if( index->initial < 0 ) return -1;
+	int etat = index->initial;
+	long numero = 0;
+	for( ; *mot; mot++ ){
+		if( index->final[etat] ) numero++;
+		int i;
+		int suivant = -1;
+		for( i = index->debut[etat]; i < index->debut[etat+1]; i++ ){
+			if( index->lettres[i] == *mot ){
+				suivant = index->cibles[i];
+				break;
+			}
+			if( (unsigned char) index->lettres[i] > (unsigned char) *mot ) break;
+			numero += index->nb_suffixes[ index->cibles[i] ];
+		}
+		if( suivant < 0 ) return -1;
+		etat = suivant;
+	}
+	return index->final[etat] ? numero : -1;
+}
+
+char * mot_du_numero( const Index_mots * index, long numero ){
+	if( numero < 0 || numero >= nombre_de_mots_index( index ) ) return NULL;
+	char * mot = xmalloc( index->hauteur + 1 );
+	int longueur = 0;
+	int etat = index->initial;
+	while( 1 ){
+		if( index->final[etat] ){
+			if( numero == 0 ) break;
+			numero--;
+		}
+		int i;
+		for( i = index->debut[etat]; i < index->debut[etat+1]; i++ ){
+			long nb = index->nb_suffixes[ index->cibles[i] ];
+			if( numero < nb ) break;
+			numero -= nb;
+		}
+		assert( i < index->debut[etat+1] );
+		mot[longueur++] = index->lettres[i];
+		etat = index->cibles[i];
+	}
+	mot[longueur] = '\0';
+	return mot;
+}
@@ -0,0 +1,154 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2014, 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file dictionnaire.h */ 
+
+#ifndef __DICTIONNAIRE_H__
+#define __DICTIONNAIRE_H__
+
+#include "automate.h"
+
+/**
+ * @brief Le type d'un constructeur incrémental d'automate de dictionnaire.
+ *
+ * Les mots sont ajoutés un par un, dans l'ordre lexicographique (celui de 
+ * strcmp()). Le constructeur maintient un registre des états déjà minimisés 
+ * (algorithme de Daciuk) : seul le chemin du dernier mot ajouté n'est pas 
+ * encore minimisé. L'automate en construction est donc minimal à tout 
+ * moment, et le trie complet des mots n'existe jamais en mémoire.
+ */
+typedef struct Dictionnaire Dictionnaire;
+
+/**
+ * @brief Crée un constructeur de dictionnaire vide.
+ *
+ * @return Le constructeur créé.
+ */
+Dictionnaire * creer_dictionnaire();
+
+/**
+ * @brief Détruit un constructeur de dictionnaire.
+ *
+ * L'automate renvoyé par terminer_dictionnaire() n'est pas détruit.
+ *
+ * @param dictionnaire Le constructeur à détruire.
+ */
+void liberer_dictionnaire( Dictionnaire * dictionnaire );
+
+/**
+ * @brief Ajoute un mot au dictionnaire.
+ *
+ * Le mot doit être plus grand ou égal (pour strcmp()) au dernier mot ajouté.
+ * Un mot égal au dernier mot ajouté est ignoré.
+ *
+ * @param dictionnaire Un constructeur de dictionnaire.
+ * @param mot Le mot à ajouter.
+ * @return 1 si le mot a été ajouté, 0 si l'ordre lexicographique n'est pas
+ *         respecté ou si le dictionnaire est déjà terminé.
+ */
+int ajouter_mot_dictionnaire( Dictionnaire * dictionnaire, const char * mot );
+
+/**
+ * @brief Termine la construction et renvoie l'automate minimal (déterministe,
+ *        acyclique, non complet) reconnaissant les mots ajoutés.
+ *
+ * Les états sont numérotés de 0 à n-1 ; l'état initial est l'état n-1.
+ * La mémoire de l'automate renvoyé est laissée à la charge de l'utilisateur.
+ * Aucun mot ne peut plus être ajouté ensuite.
+ *
+ * @param dictionnaire Un constructeur de dictionnaire.
+ * @return L'automate minimal du dictionnaire.
+ */
+Automate * terminer_dictionnaire( Dictionnaire * dictionnaire );
+
+/**
+ * @brief Renvoie l'automate minimal reconnaissant un tableau de mots triés 
+ *        par ordre lexicographique.
+ *
+ * @param mots Les mots triés.
+ * @param nb_mots Le nombre de mots.
+ * @return L'automate minimal, ou NULL si les mots ne sont pas triés.
+ */
+Automate * creer_automate_dictionnaire( const char ** mots, int nb_mots );
+
+/**
+ * @brief Le type d'un index de mots.
+ *
+ * Un index est compilé à partir d'un automate déterministe acyclique. Il 
+ * associe à chaque mot reconnu son numéro, dans l'ordre lexicographique 
+ * (celui de strcmp()), entre 0 et le nombre de mots moins 1 (hachage 
+ * parfait minimal). Pour cela, chaque état stocke le nombre de suffixes 
+ * acceptés à partir de cet état.
+ */
+typedef struct Index_mots Index_mots;
+
+/**
+ * @brief Compile l'index des mots reconnus par un automate déterministe 
+ *        acyclique.
+ *
+ * L'index est indépendant de l'automate du point de vue de la mémoire.
+ *
+ * Les états qui ne mènent à aucun état final (par exemple l'état puits 
+ * d'un automate complet) sont ignorés.
+ *
+ * @param automate Un automate déterministe, ayant au plus un état initial et
+ *        reconnaissant un langage fini (par exemple renvoyé par 
+ *        terminer_dictionnaire() ou creer_automate_minimal()).
+ * @return L'index, ou NULL si l'automate n'est pas déterministe ou si son 
+ *         langage est infini.
+ */
+Index_mots * creer_index_mots( const Automate * automate );
+
+/**
+ * @brief Détruit un index de mots.
+ *
+ * @param index L'index à détruire.
+ */
+void liberer_index_mots( Index_mots * index );
+
+/**
+ * @brief Renvoie le nombre de mots de l'index.
+ *
+ * @param index Un index de mots.
+ * @return Le nombre de mots.
+ */
+long nombre_de_mots_index( const Index_mots * index );
+
+/**
+ * @brief Renvoie le numéro d'un mot dans l'index.
+ *
+ * @param index Un index de mots.
+ * @param mot Le mot à chercher.
+ * @return Le numéro du mot, ou -1 si le mot n'est pas dans l'index.
+ */
+long numero_du_mot( const Index_mots * index, const char * mot );
+
+/**
+ * @brief Renvoie le mot ayant un numéro donné dans l'index.
+ *
+ * La mémoire du mot renvoyé est laissée à la charge de l'utilisateur.
+ *
+ * @param index Un index de mots.
+ * @param numero Le numéro du mot.
+ * @return Le mot, ou NULL si le numéro est hors de l'index.
+ */
+char * mot_du_numero( const Index_mots * index, long numero );
+
+#endif
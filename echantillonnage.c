@@ -0,0 +1,183 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2014, 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "echantillonnage.h"
+#include "graphe.h"
+#include "outils.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include <limits.h>
+#include <math.h>
+
+struct Echantillonneur {
+	int longueur;
+	int nb_etats;
+	int nb_lettres;
+	char * lettres;
+	int * successeurs;          //!< successeurs[i*nb_lettres+l], ou -1.
+	int initial;                //!< Indice de l'état initial, ou -1.
+	double * poids;             //!< Mantisse du nombre de mots de longueur m de i vers un état final, en poids[m*nb_etats+i] : 0, ou dans [1/2, 1[.
+	int * exposants;            //!< Exposant de ce nombre, en exposants[m*nb_etats+i].
+	uint64_t alea;
+};
+
+/*
+ * Renvoie l'exposant du plus grand des nombres de mots de longueur m depuis 
+ * les successeurs d'un état, ou INT_MIN s'ils sont tous nuls.
+ */
+int exposant_successeurs( const Echantillonneur * e, int etat, int m ){
+	const int * successeurs = &e->successeurs[ etat * e->nb_lettres ];
+	size_t base = (size_t) m * e->nb_etats;
+	int maximum = INT_MIN;
+	int l;
+	for( l=0; l<e->nb_lettres; l++ ){
+		int s = successeurs[l];
+		if( s >= 0 && e->poids[ base + s ] > 0 && e->exposants[ base + s ] > maximum ){
+			maximum = e->exposants[ base + s ];
+		}
+	}
+	return maximum;
+}
+
+/*
+ * Renvoie le nombre de mots de longueur m depuis un successeur d'un état 
+ * par une lettre, divisé par 2^exposant.
+ */
+double poids_successeur( 
+	const Echantillonneur * e, int etat, int lettre, int m, int exposant 
+){
+	int s = e->successeurs[ etat * e->nb_lettres + lettre ];
+	if( s < 0 ) return 0;
+	size_t k = (size_t) m * e->nb_etats + s;
+	return ldexp( e->poids[k], e->exposants[k] - exposant );
+}
+
+/*
+ * Renvoie la mantisse du nombre de mots de longueur m+1 depuis un état ; 
+ * l'exposant est rangé dans 'exposant'.
+ */
+double sommer_successeurs( 
+	const Echantillonneur * e, int etat, int m, int * exposant 
+){
+	int maximum = exposant_successeurs( e, etat, m );
+	if( maximum == INT_MIN ){
+		*exposant = 0;
+		return 0;
+	}
+	double somme = 0;
+	int l;
+	for( l=0; l<e->nb_lettres; l++ ){
+		somme += poids_successeur( e, etat, l, m, maximum );
+	}
+	double mantisse = frexp( somme, exposant );
+	*exposant += maximum;
+	return mantisse;
+}
+
+Echantillonneur * creer_echantillonneur( 
+	const Automate * automate, int longueur, uint64_t graine 
+){
+	Graphe * graphe = creer_graphe( automate );
+	Echantillonneur * e = xmalloc( sizeof(Echantillonneur) );
+	int n = graphe->nb_etats;
+	int nb_lettres = graphe->nb_lettres;
+	int i, m;
+	e->longueur = longueur;
+	e->nb_etats = n;
+	e->nb_lettres = nb_lettres;
+	e->lettres = xmalloc( nb_lettres + 1 );
+	memcpy( e->lettres, graphe->lettres, nb_lettres );
+	assert( graphe->nb_initiaux <= 1 );
+	e->initial = graphe->nb_initiaux ? graphe->initiaux[0] : -1;
+	e->alea = graine;
+
+	e->successeurs = xmalloc( ( (size_t) n * nb_lettres + 1 ) * sizeof(int) );
+	for( i=0; i<n*nb_lettres; i++ ){
+		assert( graphe->debut[i+1] - graphe->debut[i] <= 1 );
+		e->successeurs[i] = 
+			graphe->debut[i] < graphe->debut[i+1] ? graphe->fins[ graphe->debut[i] ] : -1;
+	}
+
+	size_t taille = ( (size_t) longueur + 1 ) * ( n + 1 );
+	e->poids = xmalloc( taille * sizeof(double) );
+	e->exposants = xmalloc( taille * sizeof(int) );
+	for( i=0; i<n; i++ ){
+		e->poids[i] = frexp( graphe->final[i], &e->exposants[i] );
+	}
+	for( m=1; m<=longueur; m++ ){
+		for( i=0; i<n; i++ ){
+			size_t k = (size_t) m * n + i;
+			e->poids[k] = sommer_successeurs( e, i, m - 1, &e->exposants[k] );
+		}
+	}
+
+	liberer_graphe( graphe );
+	return e;
+}
+
+void liberer_echantillonneur( Echantillonneur * e ){
+	xfree( e->lettres );
+	xfree( e->successeurs );
+	xfree( e->poids );
+	xfree( e->exposants );
+	xfree( e );
+}
+
+bool tirer_mot( Echantillonneur * e, char * mot ){
+	int n = e->nb_etats;
+	if( e->initial < 0 || e->poids[ (size_t) e->longueur * n + e->initial ] == 0 ){
+		return false;
+	}
+	int etat = e->initial;
+	int position, l;
+	for( position=0; position<e->longueur; position++ ){
+		// Chaque lettre est choisie avec une probabilité proportionnelle au 
+		// nombre de mots qui complètent le préfixe.
+		int m = e->longueur - position - 1;
+		int exposant = exposant_successeurs( e, etat, m );
+		double total = 0;
+		for( l=0; l<e->nb_lettres; l++ ){
+			total += poids_successeur( e, etat, l, m, exposant );
+		}
+		double tirage = ( alea_suivant( &e->alea ) >> 11 ) * 0x1.0p-53 * total;
+		int choisie = -1;
+		for( l=0; l<e->nb_lettres; l++ ){
+			double poids = poids_successeur( e, etat, l, m, exposant );
+			if( poids == 0 ) continue;
+			choisie = l;
+			if( tirage < poids ) break;
+			tirage -= poids;
+		}
+		etat = e->successeurs[ etat * e->nb_lettres + choisie ];
+		mot[position] = e->lettres[choisie];
+	}
+	mot[e->longueur] = '\0';
+	return true;
+}
+
+size_t tirer_mots( Echantillonneur * e, size_t nb_mots, char * tampon ){
+	size_t i;
+	for( i=0; i<nb_mots; i++ ){
+		if( ! tirer_mot( e, tampon + i * ( e->longueur + 1 ) ) ) return 0;
+	}
+	return nb_mots;
+}
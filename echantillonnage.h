@@ -0,0 +1,100 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2014, 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file echantillonnage.h */ 
+
+#ifndef __ECHANTILLONNAGE_H__
+#define __ECHANTILLONNAGE_H__
+
+#include "automate.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief Tirage uniforme de mots d'une longueur donnée reconnus par un 
+ * automate déterministe.
+ *
+ * L'échantillonneur calcule à sa création, pour chaque état et chaque 
+ * longueur m jusqu'à la longueur demandée, le nombre de mots de longueur m 
+ * qui mènent de l'état à un état final. Ces nombres sont stockés sous la 
+ * forme d'une mantisse flottante et d'un exposant entier propres à chaque 
+ * état et à chaque longueur, ce qui évite tout débordement et tout 
+ * soupassement : l'uniformité est exacte à la précision des flottants près.
+ * Chaque mot est ensuite tiré lettre par lettre, en O(longueur * taille de 
+ * l'alphabet), sans rejet.
+ *
+ * Les tirages sont déterminés par la graine donnée à la création.
+ */
+typedef struct Echantillonneur Echantillonneur;
+
+/**
+ * @brief Crée un échantillonneur.
+ *
+ * L'échantillonneur est indépendant de l'automate du point de vue de la 
+ * mémoire.
+ *
+ * @param automate Un automate déterministe (par exemple le résultat de 
+ *        creer_automate_deterministe()).
+ * @param longueur La longueur des mots à tirer.
+ * @param graine La graine du générateur pseudo-aléatoire (voir 
+ *        alea_suivant()).
+ * @return L'échantillonneur.
+ */
+Echantillonneur * creer_echantillonneur( 
+	const Automate * automate, int longueur, uint64_t graine 
+);
+
+/**
+ * @brief Détruit un échantillonneur.
+ *
+ * @param echantillonneur L'échantillonneur à détruire.
+ */
+void liberer_echantillonneur( Echantillonneur * echantillonneur );
+
+/**
+ * @brief Tire un mot uniformément parmi les mots reconnus de la longueur de 
+ * l'échantillonneur.
+ *
+ * @param echantillonneur Un échantillonneur.
+ * @param mot Reçoit le mot : un tableau d'au moins longueur+1 caractères.
+ * @return false si aucun mot de cette longueur n'est reconnu.
+ */
+bool tirer_mot( Echantillonneur * echantillonneur, char * mot );
+
+/**
+ * @brief Tire plusieurs mots à la suite.
+ *
+ * Le résultat est le même que celui de nb_mots appels à tirer_mot().
+ *
+ * @param echantillonneur Un échantillonneur.
+ * @param nb_mots Le nombre de mots à tirer.
+ * @param tampon Reçoit les mots les uns à la suite des autres, chacun 
+ *        terminé par '\0' : un tableau d'au moins nb_mots*(longueur+1) 
+ *        caractères.
+ * @return Le nombre de mots tirés : nb_mots, ou 0 si aucun mot de cette 
+ *         longueur n'est reconnu.
+ */
+size_t tirer_mots( 
+	Echantillonneur * echantillonneur, size_t nb_mots, char * tampon 
+);
+
+#endif
@@ -0,0 +1,273 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2014, 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "enumeration.h"
+#include "graphe.h"
+#include "composantes.h"
+#include "outils.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+typedef enum {
+	ENUMERATION_DEBUT,      //!< Aucun mot n'a encore été produit.
+	ENUMERATION_EN_ATTENTE, //!< Le mot courant n'a pas encore été renvoyé.
+	ENUMERATION_RENVOYE,    //!< Le mot courant a été renvoyé.
+	ENUMERATION_TERMINEE    //!< Il n'y a plus de mot.
+} Etape_enumeration;
+
+struct Enumerateur {
+	Graphe * graphe;
+	int initial;                //!< Indice de l'état initial, ou -1.
+	bool fini;                  //!< Le langage est-il fini ?
+	int longueur_maximale;      //!< Si le langage est fini.
+	int longueur_calculee;
+	uint64_t * comptes;         //!< comptes[m*nb_etats+i] : mots de longueur m de i vers un état final.
+	Etape_enumeration etape;
+	int longueur;               //!< Longueur du mot courant.
+	int capacite;
+	char * mot;
+	int * chemin;               //!< chemin[j] : état atteint après j lettres du mot courant.
+};
+
+uint64_t addition_saturee( uint64_t a, uint64_t b ){
+	return a + b < a ? UINT64_MAX : a + b;
+}
+
+int successeur_enumerateur( const Enumerateur * e, int etat, int lettre ){
+	const Graphe * graphe = e->graphe;
+	int cellule = etat * graphe->nb_lettres + lettre;
+	assert( graphe->debut[cellule+1] - graphe->debut[cellule] <= 1 );
+	if( graphe->debut[cellule] == graphe->debut[cellule+1] ) return -1;
+	return graphe->fins[ graphe->debut[cellule] ];
+}
+
+/**
+ * @brief Calcule les comptes jusqu'à la longueur donnée.
+ */
+void etendre_comptes_enumerateur( Enumerateur * e, int longueur ){
+	if( longueur <= e->longueur_calculee ) return;
+	int n = e->graphe->nb_etats;
+	e->comptes = xrealloc( 
+		e->comptes, ( (size_t) longueur + 1 ) * ( n + 1 ) * sizeof(uint64_t) 
+	);
+	int m, i, l;
+	for( m=e->longueur_calculee+1; m<=longueur; m++ ){
+		const uint64_t * precedents = &e->comptes[ (size_t) ( m - 1 ) * n ];
+		uint64_t * courants = &e->comptes[ (size_t) m * n ];
+		for( i=0; i<n; i++ ){
+			courants[i] = 0;
+			for( l=0; l<e->graphe->nb_lettres; l++ ){
+				int s = successeur_enumerateur( e, i, l );
+				if( s >= 0 ) courants[i] = addition_saturee( courants[i], precedents[s] );
+			}
+		}
+	}
+	e->longueur_calculee = longueur;
+}
+
+uint64_t compte_enumerateur( Enumerateur * e, int longueur, int etat ){
+	if( etat < 0 ) return 0;
+	etendre_comptes_enumerateur( e, longueur );
+	return e->comptes[ (size_t) longueur * e->graphe->nb_etats + etat ];
+}
+
+void reserver_mot_enumerateur( Enumerateur * e, int longueur ){
+	if( longueur < e->capacite ) return;
+	e->capacite = 2 * longueur + 1;
+	e->mot = xrealloc( e->mot, e->capacite + 1 );
+	e->chemin = xrealloc( e->chemin, ( e->capacite + 1 ) * sizeof(int) );
+}
+
+Enumerateur * creer_enumerateur( const Automate * automate ){
+	Enumerateur * e = xmalloc( sizeof(Enumerateur) );
+	e->graphe = creer_graphe( automate );
+	assert( e->graphe->nb_initiaux <= 1 );
+	e->initial = e->graphe->nb_initiaux ? e->graphe->initiaux[0] : -1;
+	e->fini = longueur_maximale_mot( automate, &e->longueur_maximale );
+	int n = e->graphe->nb_etats;
+	int i;
+	e->comptes = xmalloc( ( n + 1 ) * sizeof(uint64_t) );
+	for( i=0; i<n; i++ ) e->comptes[i] = e->graphe->final[i];
+	e->longueur_calculee = 0;
+	e->etape = ENUMERATION_DEBUT;
+	e->longueur = 0;
+	e->capacite = 0;
+	e->mot = NULL;
+	e->chemin = NULL;
+	reserver_mot_enumerateur( e, 16 );
+	return e;
+}
+
+void liberer_enumerateur( Enumerateur * e ){
+	liberer_graphe( e->graphe );
+	xfree( e->comptes );
+	xfree( e->mot );
+	xfree( e->chemin );
+	xfree( e );
+}
+
+/**
+ * @brief Complète le mot courant à partir de la position j par le plus petit
+ * suffixe possible ; il doit en exister un.
+ */
+void completer_mot_enumerateur( Enumerateur * e, int j ){
+	int n = e->longueur;
+	int position, l;
+	for( position=j; position<n; position++ ){
+		int etat = e->chemin[position];
+		for( l=0; l<e->graphe->nb_lettres; l++ ){
+			int s = successeur_enumerateur( e, etat, l );
+			if( compte_enumerateur( e, n - position - 1, s ) > 0 ){
+				e->mot[position] = e->graphe->lettres[l];
+				e->chemin[position+1] = s;
+				break;
+			}
+		}
+		assert( l < e->graphe->nb_lettres );
+	}
+	e->mot[n] = '\0';
+}
+
+/**
+ * @brief Se place sur le premier mot reconnu de longueur au moins 'longueur'.
+ */
+bool chercher_longueur_enumerateur( Enumerateur * e, int longueur ){
+	while( compte_enumerateur( e, longueur, e->initial ) == 0 ){
+		if( e->initial < 0 || ( e->fini && longueur >= e->longueur_maximale ) ){
+			e->etape = ENUMERATION_TERMINEE;
+			return false;
+		}
+		longueur++;
+	}
+	reserver_mot_enumerateur( e, longueur );
+	e->longueur = longueur;
+	e->chemin[0] = e->initial;
+	completer_mot_enumerateur( e, 0 );
+	e->etape = ENUMERATION_EN_ATTENTE;
+	return true;
+}
+
+/**
+ * @brief Passe au mot reconnu suivant de même longueur.
+ */
+bool incrementer_mot_enumerateur( Enumerateur * e ){
+	int n = e->longueur;
+	int j, l;
+	for( j=n-1; j>=0; j-- ){
+		int etat = e->chemin[j];
+		int courante = e->graphe->indice_lettre[ (unsigned char) e->mot[j] ];
+		for( l=courante+1; l<e->graphe->nb_lettres; l++ ){
+			int s = successeur_enumerateur( e, etat, l );
+			if( compte_enumerateur( e, n - j - 1, s ) > 0 ){
+				e->mot[j] = e->graphe->lettres[l];
+				e->chemin[j+1] = s;
+				completer_mot_enumerateur( e, j + 1 );
+				return true;
+			}
+		}
+	}
+	return false;
+}
+
+const char * mot_suivant( Enumerateur * e ){
+	switch( e->etape ){
+		case ENUMERATION_DEBUT :
+			if( ! chercher_longueur_enumerateur( e, 0 ) ) return NULL;
+			break;
+		case ENUMERATION_EN_ATTENTE :
+			break;
+		case ENUMERATION_RENVOYE :
+			if( 
+				! incrementer_mot_enumerateur( e ) 
+				&& ! chercher_longueur_enumerateur( e, e->longueur + 1 )
+			){
+				return NULL;
+			}
+			break;
+		case ENUMERATION_TERMINEE :
+			return NULL;
+	}
+	e->etape = ENUMERATION_RENVOYE;
+	return e->mot;
+}
+
+uint64_t nombre_de_mots_enumerateur( Enumerateur * e, int longueur ){
+	return compte_enumerateur( e, longueur, e->initial );
+}
+
+bool mot_de_rang( Enumerateur * e, int longueur, uint64_t rang, char * mot ){
+	if( compte_enumerateur( e, longueur, e->initial ) <= rang ) return false;
+	int etat = e->initial;
+	int position, l;
+	for( position=0; position<longueur; position++ ){
+		for( l=0; l<e->graphe->nb_lettres; l++ ){
+			int s = successeur_enumerateur( e, etat, l );
+			uint64_t compte = compte_enumerateur( e, longueur - position - 1, s );
+			if( rang < compte ){
+				mot[position] = e->graphe->lettres[l];
+				etat = s;
+				break;
+			}
+			rang -= compte;
+		}
+	}
+	mot[longueur] = '\0';
+	return true;
+}
+
+bool positionner_enumerateur( Enumerateur * e, int longueur, uint64_t rang ){
+	reserver_mot_enumerateur( e, longueur );
+	if( ! mot_de_rang( e, longueur, rang, e->mot ) ){
+		chercher_longueur_enumerateur( e, longueur + 1 );
+		return false;
+	}
+	e->longueur = longueur;
+	e->chemin[0] = e->initial;
+	int position;
+	for( position=0; position<longueur; position++ ){
+		e->chemin[position+1] = successeur_enumerateur( 
+			e, e->chemin[position], 
+			e->graphe->indice_lettre[ (unsigned char) e->mot[position] ]
+		);
+	}
+	e->etape = ENUMERATION_EN_ATTENTE;
+	return true;
+}
+
+bool rang_du_mot( Enumerateur * e, const char * mot, uint64_t * rang ){
+	int longueur = strlen( mot );
+	int etat = e->initial;
+	int position, l;
+	*rang = 0;
+	for( position=0; position<longueur && etat >= 0; position++ ){
+		int lettre = e->graphe->indice_lettre[ (unsigned char) mot[position] ];
+		if( lettre < 0 ) return false;
+		for( l=0; l<lettre; l++ ){
+			int s = successeur_enumerateur( e, etat, l );
+			*rang = addition_saturee( 
+				*rang, compte_enumerateur( e, longueur - position - 1, s ) 
+			);
+		}
+		etat = successeur_enumerateur( e, etat, lettre );
+	}
+	return etat >= 0 && e->graphe->final[etat];
+}
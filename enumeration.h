@@ -0,0 +1,121 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2014, 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file enumeration.h */ 
+
+#ifndef __ENUMERATION_H__
+#define __ENUMERATION_H__
+
+#include "automate.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * @brief Énumérateur des mots reconnus par un automate déterministe, dans 
+ * l'ordre militaire (par longueur, puis dans l'ordre de l'alphabet).
+ *
+ * L'énumérateur calcule, à la demande, le nombre de mots de chaque longueur 
+ * qui mènent de chaque état à un état final. Chaque mot est alors produit en
+ * O(longueur * taille de l'alphabet), sans jamais produire de mot rejeté.
+ *
+ * Les mots d'une longueur donnée sont numérotés à partir de 0 dans l'ordre 
+ * de l'alphabet (voir mot_de_rang() et rang_du_mot()), ce qui permet de 
+ * partager une énumération en intervalles de rangs disjoints, chacun étant
+ * parcouru par positionner_enumerateur() puis mot_suivant().
+ *
+ * Les comptes sont des entiers de 64 bits, saturés à UINT64_MAX.
+ */
+typedef struct Enumerateur Enumerateur;
+
+/**
+ * @brief Crée un énumérateur.
+ *
+ * L'énumérateur est indépendant de l'automate du point de vue de la mémoire.
+ *
+ * @param automate Un automate déterministe (par exemple le résultat de 
+ *        creer_automate_deterministe()).
+ * @return L'énumérateur, positionné avant le mot vide.
+ */
+Enumerateur * creer_enumerateur( const Automate * automate );
+
+/**
+ * @brief Détruit un énumérateur.
+ *
+ * @param enumerateur L'énumérateur à détruire.
+ */
+void liberer_enumerateur( Enumerateur * enumerateur );
+
+/**
+ * @brief Renvoie le mot reconnu suivant.
+ *
+ * @param enumerateur Un énumérateur.
+ * @return Le mot, valide jusqu'au prochain appel sur l'énumérateur, ou NULL
+ *         si le langage ne contient plus de mot.
+ */
+const char * mot_suivant( Enumerateur * enumerateur );
+
+/**
+ * @brief Positionne un énumérateur : le prochain appel de mot_suivant() 
+ * renverra le mot de longueur et de rang donnés, ou, s'il n'existe pas, le 
+ * premier mot plus long.
+ *
+ * @param enumerateur Un énumérateur.
+ * @param longueur Une longueur.
+ * @param rang Un rang parmi les mots de cette longueur.
+ * @return true si le mot de rang 'rang' existe.
+ */
+bool positionner_enumerateur( 
+	Enumerateur * enumerateur, int longueur, uint64_t rang 
+);
+
+/**
+ * @brief Renvoie le nombre de mots reconnus d'une longueur donnée.
+ *
+ * @param enumerateur Un énumérateur.
+ * @param longueur Une longueur.
+ * @return Le nombre de mots, saturé à UINT64_MAX.
+ */
+uint64_t nombre_de_mots_enumerateur( Enumerateur * enumerateur, int longueur );
+
+/**
+ * @brief Calcule le mot reconnu de longueur et de rang donnés.
+ *
+ * @param enumerateur Un énumérateur.
+ * @param longueur Une longueur.
+ * @param rang Le rang du mot parmi les mots reconnus de cette longueur.
+ * @param mot Reçoit le mot : un tableau d'au moins longueur+1 caractères.
+ * @return false si le rang est au moins le nombre de mots de cette longueur.
+ */
+bool mot_de_rang( 
+	Enumerateur * enumerateur, int longueur, uint64_t rang, char * mot 
+);
+
+/**
+ * @brief Calcule le rang d'un mot parmi les mots reconnus de même longueur.
+ *
+ * @param enumerateur Un énumérateur.
+ * @param mot Un mot.
+ * @param rang Reçoit le rang du mot, saturé à UINT64_MAX.
+ * @return false si le mot n'est pas reconnu.
+ */
+bool rang_du_mot( Enumerateur * enumerateur, const char * mot, uint64_t * rang );
+
+#endif
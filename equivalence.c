@@ -0,0 +1,203 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2014, 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "equivalence.h"
+#include "determinisation.h"
+#include "vecteurs.h"
+#include "outils.h"
+
+#include <string.h>
+
+/*
+ * Les états des deux déterminisations sont les nœuds 1 + 2*etat + cote de 
+ * l'union-find ; le nœud 0 est l'état puits, commun aux deux côtés, atteint 
+ * par une lettre que l'automate n'utilise pas. Il est noté -1.
+ */
+typedef struct {
+	Determinisation * d[2];
+	int nb_lettres;
+	char lettres[256];
+	int indice[2][256];         // Indice d'une lettre commune dans chaque côté, ou -1.
+	int * parent;
+	int * taille;
+	int capacite;
+} Equivalence;
+
+int successeur_equivalence( Equivalence * e, int cote, int etat, int lettre ){
+	if( etat < 0 || e->indice[cote][lettre] < 0 ) return -1;
+	return successeur_determinisation( e->d[cote], etat, e->indice[cote][lettre] );
+}
+
+int est_final_equivalence( const Equivalence * e, int cote, int etat ){
+	return etat >= 0 && est_final_determinisation( e->d[cote], etat );
+}
+
+int trouver_classe_equivalence( Equivalence * e, int etat, int cote ){
+	int noeud = etat < 0 ? 0 : 1 + 2*etat + cote;
+	if( noeud >= e->capacite ){
+		int ancienne = e->capacite;
+		while( noeud >= e->capacite ) e->capacite *= 2;
+		e->parent = xrealloc( e->parent, e->capacite * sizeof(int) );
+		e->taille = xrealloc( e->taille, e->capacite * sizeof(int) );
+		int i;
+		for( i=ancienne; i<e->capacite; i++ ){
+			e->parent[i] = i;
+			e->taille[i] = 1;
+		}
+	}
+	while( e->parent[noeud] != noeud ){
+		e->parent[noeud] = e->parent[ e->parent[noeud] ];
+		noeud = e->parent[noeud];
+	}
+	return noeud;
+}
+
+/*
+ * Fusionne les classes de x (côté 0) et de y (côté 1) ; renvoie 0 si elles 
+ * étaient déjà fusionnées.
+ */
+int fusionner_equivalence( Equivalence * e, int x, int y ){
+	int cx = trouver_classe_equivalence( e, x, 0 );
+	int cy = trouver_classe_equivalence( e, y, 1 );
+	if( cx == cy ) return 0;
+	if( e->taille[cx] < e->taille[cy] ){
+		int tmp = cx; cx = cy; cy = tmp;
+	}
+	e->parent[cy] = cx;
+	e->taille[cx] += e->taille[cy];
+	return 1;
+}
+
+/*
+ * Parcours en largeur des couples sans union-find, en retenant le 
+ * prédécesseur de chaque couple : appelé seulement quand les automates ne 
+ * sont pas équivalents, il renvoie un plus court mot qui les distingue.
+ */
+char * mot_distinguant_equivalence( Equivalence * e ){
+	Table_vecteurs * couples = creer_table_vecteurs();
+	int capacite = 64;
+	int * predecesseur = xmalloc( capacite * sizeof(int) );
+	char * lettre = xmalloc( capacite );
+	uint64_t couple[2] = { 1, 1 };
+	int nouveau;
+	interner_vecteur( couples, couple, 2, &nouveau );
+	predecesseur[0] = -1;
+	int prochain;
+	for( prochain=0; ; prochain++ ){
+		int nb_mots;
+		const uint64_t * c = get_vecteur( couples, prochain, &nb_mots );
+		int x = (int) c[0] - 1;
+		int y = (int) c[1] - 1;
+		if( est_final_equivalence( e, 0, x ) != est_final_equivalence( e, 1, y ) ) break;
+		int l;
+		for( l=0; l<e->nb_lettres; l++ ){
+			couple[0] = successeur_equivalence( e, 0, x, l ) + 1;
+			couple[1] = successeur_equivalence( e, 1, y, l ) + 1;
+			int id = interner_vecteur( couples, couple, 2, &nouveau );
+			if( ! nouveau ) continue;
+			if( id >= capacite ){
+				capacite *= 2;
+				predecesseur = xrealloc( predecesseur, capacite * sizeof(int) );
+				lettre = xrealloc( lettre, capacite );
+			}
+			predecesseur[id] = prochain;
+			lettre[id] = e->lettres[l];
+		}
+	}
+
+	int longueur = 0;
+	int id;
+	for( id=prochain; predecesseur[id] >= 0; id=predecesseur[id] ) longueur++;
+	char * mot = xmalloc( longueur + 1 );
+	mot[longueur] = '\0';
+	for( id=prochain; predecesseur[id] >= 0; id=predecesseur[id] ){
+		mot[ --longueur ] = lettre[id];
+	}
+	xfree( predecesseur );
+	xfree( lettre );
+	liberer_table_vecteurs( couples );
+	return mot;
+}
+
+bool equivalent( const Automate * a, const Automate * b, char ** mot ){
+	Equivalence e;
+	e.d[0] = creer_determinisation( a );
+	e.d[1] = creer_determinisation( b );
+	const Graphe * g[2] = { 
+		graphe_determinisation( e.d[0] ), graphe_determinisation( e.d[1] ) 
+	};
+	int cote, u;
+	e.nb_lettres = 0;
+	for( u=0; u<256; u++ ){
+		if( g[0]->indice_lettre[u] < 0 && g[1]->indice_lettre[u] < 0 ) continue;
+		for( cote=0; cote<2; cote++ ){
+			e.indice[cote][ e.nb_lettres ] = g[cote]->indice_lettre[u];
+		}
+		e.lettres[ e.nb_lettres++ ] = (char) u;
+	}
+	e.capacite = 64;
+	e.parent = xmalloc( e.capacite * sizeof(int) );
+	e.taille = xmalloc( e.capacite * sizeof(int) );
+	for( u=0; u<e.capacite; u++ ){
+		e.parent[u] = u;
+		e.taille[u] = 1;
+	}
+
+	// File des couples à examiner : l'état 0 de chaque déterminisation est 
+	// la partie des états initiaux.
+	int capacite_file = 64;
+	int * file = xmalloc( 2 * capacite_file * sizeof(int) );
+	int tete = 0, queue = 0;
+	file[0] = 0;
+	file[1] = 0;
+	queue = 1;
+	fusionner_equivalence( &e, 0, 0 );
+	bool resultat = true;
+	while( tete < queue ){
+		int x = file[ 2*tete ];
+		int y = file[ 2*tete + 1 ];
+		tete++;
+		if( est_final_equivalence( &e, 0, x ) != est_final_equivalence( &e, 1, y ) ){
+			resultat = false;
+			break;
+		}
+		int l;
+		for( l=0; l<e.nb_lettres; l++ ){
+			int x2 = successeur_equivalence( &e, 0, x, l );
+			int y2 = successeur_equivalence( &e, 1, y, l );
+			if( ! fusionner_equivalence( &e, x2, y2 ) ) continue;
+			if( queue == capacite_file ){
+				capacite_file *= 2;
+				file = xrealloc( file, 2 * capacite_file * sizeof(int) );
+			}
+			file[ 2*queue ] = x2;
+			file[ 2*queue + 1 ] = y2;
+			queue++;
+		}
+	}
+
+	if( mot ) *mot = resultat ? NULL : mot_distinguant_equivalence( &e );
+	xfree( file );
+	xfree( e.parent );
+	xfree( e.taille );
+	liberer_determinisation( e.d[0] );
+	liberer_determinisation( e.d[1] );
+	return resultat;
+}
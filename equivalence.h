@@ -0,0 +1,52 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2014, 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file equivalence.h */ 
+
+#ifndef __EQUIVALENCE_H__
+#define __EQUIVALENCE_H__
+
+#include "automate.h"
+
+#include <stdbool.h>
+
+/**
+ * @brief Teste si deux automates reconnaissent le même langage (algorithme 
+ *        de Hopcroft et Karp).
+ *
+ * Les deux automates sont déterminisés paresseusement (voir 
+ * determinisation.h) : seules les parties atteintes par le parcours sont 
+ * construites. Les couples de parties sont parcourus en largeur et fusionnés
+ * dans une structure union-find ; un couple dont les deux parties sont déjà 
+ * dans la même classe n'est pas exploré. Aucun complémentaire ni aucun 
+ * produit n'est construit. Les langages sont comparés sur l'union des 
+ * alphabets : deux automates qui ne diffèrent que par des lettres 
+ * inutilisées sont équivalents.
+ *
+ * @param a Le premier automate.
+ * @param b Le second automate.
+ * @param mot Si non NULL, reçoit NULL si les automates sont équivalents, et 
+ *        sinon un plus court mot reconnu par un seul des deux automates, à 
+ *        libérer avec xfree().
+ * @return true si les automates sont équivalents.
+ */
+bool equivalent( const Automate * a, const Automate * b, char ** mot );
+
+#endif
@@ -0,0 +1,202 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2014, 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "estimation.h"
+#include "determinisation.h"
+#include "graphe.h"
+#include "outils.h"
+
+#include <math.h>
+#include <string.h>
+
+/*
+ * Au-delà de cette part de marches terminées dans une partie absorbante, 
+ * l'échantillon n'informe plus sur le nombre de parties.
+ */
+#define PROPORTION_ABSORBANTE_MAX_ESTIMATION 0.5
+
+void calculer_degres_estimation(
+	const Graphe * g, Estimation_determinisation * estimation
+){
+	int i, l;
+	estimation->nb_etats = g->nb_etats;
+	estimation->nb_transitions = g->nb_transitions;
+	estimation->nb_lettres = g->nb_lettres;
+	for( l=0; l<g->nb_lettres; l++ ){
+		estimation->lettres[l] = g->lettres[l];
+		estimation->degre_max[l] = 0;
+		estimation->nb_etats_non_deterministes[l] = 0;
+		long total = 0;
+		for( i=0; i<g->nb_etats; i++ ){
+			int c = i*g->nb_lettres + l;
+			int degre = g->debut[c+1] - g->debut[c];
+			total += degre;
+			if( degre > estimation->degre_max[l] ) estimation->degre_max[l] = degre;
+			if( degre > 1 ) estimation->nb_etats_non_deterministes[l]++;
+		}
+		estimation->degre_moyen[l] = g->nb_etats ? (double) total / g->nb_etats : 0;
+	}
+}
+
+/*
+ * Renvoie 1 si la partie est absorbante : toutes ses transitions bouclent.
+ */
+int partie_absorbante_estimation( Determinisation * d, int etat ){
+	const Graphe * g = graphe_determinisation( d );
+	int l;
+	for( l=0; l<g->nb_lettres; l++ ){
+		if( successeur_determinisation( d, etat, l ) != etat ) return 0;
+	}
+	return 1;
+}
+
+/*
+ * Marque (bit 'bit' de marques[]) les extrémités d'au plus nb_marches marches 
+ * aléatoires, et compte dans *nb_absorbantes celles qui sont absorbantes. 
+ * Renvoie le nombre de marches terminées avant l'épuisement du budget.
+ */
+int echantillonner_estimation(
+	Determinisation * d, Budget * budget, int nb_marches, uint64_t * graine,
+	unsigned char ** marques, int * capacite, unsigned char bit, 
+	int * nb_absorbantes
+){
+	const Graphe * g = graphe_determinisation( d );
+	int marche, pas;
+	for( marche=0; marche<nb_marches; marche++ ){
+		int longueur = g->nb_etats + 1 + alea_borne( graine, g->nb_etats + 1 );
+		int etat = 0;
+		for( pas=0; pas<longueur; pas++ ){
+			// Chaque pas peut ajouter une partie.
+			if( 
+				verifier_budget( 
+					budget, nombre_etats_determinisation( d ), 
+					memoire_determinisation( d ) 
+				) != BUDGET_RESPECTE 
+			){
+				return marche;
+			}
+			etat = successeur_determinisation( 
+				d, etat, alea_borne( graine, g->nb_lettres ) 
+			);
+		}
+		int nb_etats = nombre_etats_determinisation( d );
+		if( nb_etats > *capacite ){
+			int ancienne = *capacite;
+			while( *capacite < nb_etats ) *capacite *= 2;
+			*marques = xrealloc( *marques, *capacite );
+			memset( *marques + ancienne, 0, *capacite - ancienne );
+		}
+		(*marques)[etat] |= bit;
+		*nb_absorbantes += partie_absorbante_estimation( d, etat );
+	}
+	return nb_marches;
+}
+
+void estimer_determinisation(
+	const Automate * automate, Budget * budget, int nb_marches, uint64_t graine,
+	Estimation_determinisation * estimation
+){
+	Determinisation * d = creer_determinisation( automate );
+	const Graphe * g = graphe_determinisation( d );
+	calculer_degres_estimation( g, estimation );
+
+	// Exploration en largeur : les parties sont numérotées dans l'ordre de 
+	// leur découverte, la file est donc la suite des numéros.
+	int prochain = 0;
+	int l;
+	while( prochain < nombre_etats_determinisation( d ) ){
+		// Les comptes sont doublés : l'exploration s'arrête à la moitié des 
+		// limites d'états et de mémoire, le reste est laissé aux marches.
+		if( 
+			verifier_budget( 
+				budget, 2 * (long) nombre_etats_determinisation( d ), 
+				2 * memoire_determinisation( d ) 
+			) != BUDGET_RESPECTE 
+		){
+			break;
+		}
+		for( l=0; l<g->nb_lettres; l++ ) successeur_determinisation( d, prochain, l );
+		prochain++;
+	}
+	estimation->nb_etats_explores = prochain;
+	estimation->exploration_complete = prochain == nombre_etats_determinisation( d );
+	estimation->proportion_absorbante = 0;
+
+	if( estimation->exploration_complete || g->nb_lettres == 0 || nb_marches <= 0 ){
+		estimation->nb_etats_rencontres = nombre_etats_determinisation( d );
+		estimation->estimation = estimation->nb_etats_rencontres;
+		estimation->borne_inf = estimation->estimation;
+		estimation->borne_sup = estimation->exploration_complete ? 
+			estimation->estimation : ldexp( 1, g->nb_etats );
+		liberer_determinisation( d );
+		return;
+	}
+
+	int capacite = 16;
+	while( capacite < nombre_etats_determinisation( d ) ) capacite *= 2;
+	unsigned char * marques = xmalloc( capacite );
+	memset( marques, 0, capacite );
+	int nb_absorbantes = 0;
+	int nb_terminees = echantillonner_estimation( 
+		d, budget, nb_marches, &graine, &marques, &capacite, 1, &nb_absorbantes 
+	);
+	if( nb_terminees == nb_marches ){
+		nb_terminees += echantillonner_estimation( 
+			d, budget, nb_marches, &graine, &marques, &capacite, 2, &nb_absorbantes 
+		);
+	}
+
+	int nb_etats = nombre_etats_determinisation( d );
+	double n1 = 0, n2 = 0, m = 0;
+	int i;
+	for( i=0; i<nb_etats; i++ ){
+		n1 += marques[i] & 1;
+		n2 += ( marques[i] >> 1 ) & 1;
+		m += marques[i] == 3;
+	}
+	xfree( marques );
+
+	// Estimateur de Chapman et sa variance.
+	double chapman = ( n1 + 1 ) * ( n2 + 1 ) / ( m + 1 ) - 1;
+	double variance = ( n1 + 1 ) * ( n2 + 1 ) * ( n1 - m ) * ( n2 - m ) 
+		/ ( ( m + 1 ) * ( m + 1 ) * ( m + 2 ) );
+	double ecart = 1.96 * sqrt( variance );
+	double minimum = nb_etats;
+	double maximum = ldexp( 1, g->nb_etats );
+
+	estimation->nb_etats_rencontres = nb_etats;
+	estimation->proportion_absorbante = 
+		nb_terminees ? (double) nb_absorbantes / nb_terminees : 0;
+	estimation->estimation = fmin( fmax( chapman, minimum ), maximum );
+	// Sans recapture, l'échantillon ne borne rien. Une recapture complète ne 
+	// borne rien non plus : elle vient le plus souvent de marches piégées 
+	// dans quelques parties absorbantes (le puits vide par exemple), et la 
+	// variance nulle donnerait un intervalle de largeur nulle.
+	int degenere = m == 0 || m >= fmin( n1, n2 ) 
+		|| estimation->proportion_absorbante >= PROPORTION_ABSORBANTE_MAX_ESTIMATION;
+	if( degenere ){
+		estimation->borne_inf = minimum;
+		estimation->borne_sup = maximum;
+	}else{
+		estimation->borne_inf = fmin( fmax( chapman - ecart, minimum ), maximum );
+		estimation->borne_sup = fmin( fmax( chapman + ecart, minimum ), maximum );
+	}
+	liberer_determinisation( d );
+}
@@ -0,0 +1,96 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2014, 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file estimation.h */ 
+
+#ifndef __ESTIMATION_H__
+#define __ESTIMATION_H__
+
+#include "automate.h"
+#include "budget.h"
+
+#include <stdint.h>
+
+/**
+ * @brief Estimation du coût de la déterminisation d'un automate.
+ */
+typedef struct {
+	// Indicateurs structurels de l'automate, par lettre.
+	int nb_etats;
+	int nb_transitions;
+	int nb_lettres;
+	char lettres[256];                        ///< Dans l'ordre de l'alphabet.
+	int degre_max[256];                       ///< Plus grand nombre de transitions d'un état par la lettre.
+	double degre_moyen[256];                  ///< Nombre moyen de transitions d'un état par la lettre.
+	int nb_etats_non_deterministes[256];      ///< États ayant plusieurs transitions par la lettre.
+
+	// Exploration partielle.
+	long nb_etats_explores;      ///< Parties dont les successeurs ont été calculés.
+	int exploration_complete;    ///< 1 si toutes les parties accessibles ont été explorées.
+	long nb_etats_rencontres;    ///< Parties distinctes rencontrées en tout.
+	double proportion_absorbante; ///< Part des marches aléatoires terminées dans une partie absorbante.
+
+	// Estimation du nombre d'états de creer_automate_deterministe().
+	double estimation;
+	double borne_inf;
+	double borne_sup;
+} Estimation_determinisation;
+
+/**
+ * @brief Estime le nombre d'états du déterminisé d'un automate.
+ *
+ * Les parties accessibles sont d'abord explorées en largeur tant que le 
+ * budget le permet. Si l'exploration se termine, le nombre d'états est 
+ * exact et les bornes lui sont égales.
+ *
+ * Sinon, deux échantillons de nb_marches parties sont tirés, chaque partie 
+ * étant l'extrémité d'une marche aléatoire depuis la partie initiale (de 
+ * longueur uniforme entre n+1 et 2n+1 où n est le nombre d'états de 
+ * l'automate, lettres uniformes). Le nombre 
+ * de parties est estimé par capture-recapture (estimateur de Chapman), 
+ * avec un intervalle de confiance à 95 % ; l'estimation est ramenée entre 
+ * le nombre de parties rencontrées et 2^nb_etats. Les marches ne tirent pas 
+ * les parties uniformément : l'estimation est un ordre de grandeur.
+ *
+ * Si l'échantillon n'apporte pas d'information (aucune recapture, recapture 
+ * de tout le plus petit échantillon, ou au moins la moitié des marches 
+ * terminées dans une partie absorbante comme le puits vide), l'intervalle 
+ * est élargi à [nombre de parties rencontrées, 2^nb_etats].
+ *
+ * Le budget limite toute l'estimation, vérifié à chaque pas des marches 
+ * aléatoires comme à chaque partie explorée. L'exploration en largeur 
+ * s'arrête à la moitié des limites d'états et de mémoire, pour laisser le 
+ * reste aux marches. Si le budget interrompt les marches, l'estimation 
+ * repose sur les marches terminées (le second échantillon peut être plus 
+ * petit, voire vide, ce qui élargit l'intervalle).
+ *
+ * @param automate L'automate.
+ * @param budget Le budget de l'exploration, ou NULL pour une exploration 
+ *               complète.
+ * @param nb_marches Le nombre de marches aléatoires par échantillon.
+ * @param graine La graine du générateur pseudo-aléatoire.
+ * @param estimation Reçoit l'estimation.
+ */
+void estimer_determinisation(
+	const Automate * automate, Budget * budget, int nb_marches, uint64_t graine,
+	Estimation_determinisation * estimation
+);
+
+#endif
@@ -0,0 +1,212 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2014, 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "graphe.h"
+#include "automate.h"
+#include "ensemble.h"
+#include "outils.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+int comparer_entiers_graphe( const void * a, const void * b ){
+	int x = *(const int*) a;
+	int y = *(const int*) b;
+	return ( x > y ) - ( x < y );
+}
+
+int indice_etat_graphe( const Graphe * graphe, int etat ){
+	const int * res = bsearch(
+		&etat, graphe->etats, graphe->nb_etats, sizeof(int),
+		comparer_entiers_graphe
+	);
+	return res ? (int) ( res - graphe->etats ) : -1;
+}
+
+void action_compter_transitions_graphe(
+	int origine, char lettre, int fin, void* data
+){
+	Graphe * graphe = (Graphe*) data;
+	int i = indice_etat_graphe( graphe, origine );
+	int l = graphe->indice_lettre[ (unsigned char) lettre ];
+	graphe->debut[ i*graphe->nb_lettres + l + 1 ]++;
+}
+
+void action_placer_transitions_graphe(
+	int origine, char lettre, int fin, void* data
+){
+	Graphe * graphe = (Graphe*) data;
+	int i = indice_etat_graphe( graphe, origine );
+	int l = graphe->indice_lettre[ (unsigned char) lettre ];
+	// debut[] sert temporairement de curseur d'écriture (décalé d'une case).
+	graphe->fins[ graphe->debut[ i*graphe->nb_lettres + l + 1 ]++ ] =
+		indice_etat_graphe( graphe, fin );
+}
+
+Graphe * creer_graphe( const Automate * automate ){
+	Graphe * graphe = xmalloc( sizeof(Graphe) );
+	Ensemble_iterateur it;
+	int i;
+
+	graphe->nb_etats = taille_ensemble( get_etats( automate ) );
+	graphe->etats = xmalloc( ( graphe->nb_etats + 1 ) * sizeof(int) );
+	i = 0;
+	for(
+		it = premier_iterateur_ensemble( get_etats( automate ) );
+		! iterateur_ensemble_est_vide( it );
+		it = iterateur_suivant_ensemble( it )
+	){
+		graphe->etats[i++] = get_element( it );
+	}
+
+	graphe->nb_lettres = taille_ensemble( get_alphabet( automate ) );
+	graphe->lettres = xmalloc( graphe->nb_lettres + 1 );
+	for( i=0; i<256; i++ ) graphe->indice_lettre[i] = -1;
+	i = 0;
+	for(
+		it = premier_iterateur_ensemble( get_alphabet( automate ) );
+		! iterateur_ensemble_est_vide( it );
+		it = iterateur_suivant_ensemble( it )
+	){
+		char lettre = (char) get_element( it );
+		graphe->lettres[i] = lettre;
+		graphe->indice_lettre[ (unsigned char) lettre ] = i;
+		i++;
+	}
+
+	int nb_cases = graphe->nb_etats * graphe->nb_lettres;
+	graphe->debut = xmalloc( ( nb_cases + 2 ) * sizeof(int) );
+	memset( graphe->debut, 0, ( nb_cases + 2 ) * sizeof(int) );
+	pour_toute_transition( automate, action_compter_transitions_graphe, graphe );
+	for( i=1; i<=nb_cases; i++ ) graphe->debut[i] += graphe->debut[i-1];
+	graphe->nb_transitions = graphe->debut[nb_cases];
+	// Après ce décalage, debut[c+1] est le début de la case c ; le placement
+	// le fait avancer jusqu'à la fin de la case c, c'est à dire le début de 
+	// la case c+1.
+	memmove( graphe->debut + 1, graphe->debut, nb_cases * sizeof(int) );
+	graphe->debut[0] = 0;
+	graphe->fins = xmalloc( ( graphe->nb_transitions + 1 ) * sizeof(int) );
+	pour_toute_transition( automate, action_placer_transitions_graphe, graphe );
+	for( i=0; i<nb_cases; i++ ){
+		qsort(
+			graphe->fins + graphe->debut[i], graphe->debut[i+1] - graphe->debut[i],
+			sizeof(int), comparer_entiers_graphe
+		);
+	}
+
+	graphe->nb_initiaux = taille_ensemble( get_initiaux( automate ) );
+	graphe->initiaux = xmalloc( ( graphe->nb_initiaux + 1 ) * sizeof(int) );
+	i = 0;
+	for(
+		it = premier_iterateur_ensemble( get_initiaux( automate ) );
+		! iterateur_ensemble_est_vide( it );
+		it = iterateur_suivant_ensemble( it )
+	){
+		graphe->initiaux[i++] = indice_etat_graphe( graphe, get_element( it ) );
+	}
+
+	graphe->final = xmalloc( graphe->nb_etats + 1 );
+	memset( graphe->final, 0, graphe->nb_etats + 1 );
+	for(
+		it = premier_iterateur_ensemble( get_finaux( automate ) );
+		! iterateur_ensemble_est_vide( it );
+		it = iterateur_suivant_ensemble( it )
+	){
+		graphe->final[ indice_etat_graphe( graphe, get_element( it ) ) ] = 1;
+	}
+
+	graphe->debut_inverse = NULL;
+	graphe->origines = NULL;
+	return graphe;
+}
+
+void calculer_inverse_graphe( Graphe * graphe ){
+	if( graphe->debut_inverse ) return;
+	int n = graphe->nb_etats;
+	int nb_lettres = graphe->nb_lettres;
+	int nb_cases = n * nb_lettres;
+	int i, l, k;
+
+	graphe->debut_inverse = xmalloc( ( nb_cases + 2 ) * sizeof(int) );
+	memset( graphe->debut_inverse, 0, ( nb_cases + 2 ) * sizeof(int) );
+	graphe->origines = xmalloc( ( graphe->nb_transitions + 1 ) * sizeof(int) );
+
+	for( i=0; i<n; i++ ){
+		for( l=0; l<nb_lettres; l++ ){
+			for( k = graphe->debut[i*nb_lettres+l]; k < graphe->debut[i*nb_lettres+l+1]; k++ ){
+				graphe->debut_inverse[ graphe->fins[k]*nb_lettres + l + 1 ]++;
+			}
+		}
+	}
+	for( i=1; i<=nb_cases; i++ ) graphe->debut_inverse[i] += graphe->debut_inverse[i-1];
+	memmove( graphe->debut_inverse + 1, graphe->debut_inverse, nb_cases * sizeof(int) );
+	graphe->debut_inverse[0] = 0;
+	// Les origines sont parcourues par ordre croissant : chaque case reste triée.
+	for( i=0; i<n; i++ ){
+		for( l=0; l<nb_lettres; l++ ){
+			for( k = graphe->debut[i*nb_lettres+l]; k < graphe->debut[i*nb_lettres+l+1]; k++ ){
+				graphe->origines[ graphe->debut_inverse[ graphe->fins[k]*nb_lettres + l + 1 ]++ ] = i;
+			}
+		}
+	}
+}
+
+void liberer_graphe( Graphe * graphe ){
+	xfree( graphe->etats );
+	xfree( graphe->lettres );
+	xfree( graphe->debut );
+	xfree( graphe->fins );
+	xfree( graphe->debut_inverse );
+	xfree( graphe->origines );
+	xfree( graphe->initiaux );
+	xfree( graphe->final );
+	xfree( graphe );
+}
+
+int parcourir_graphe(
+	const Graphe * graphe, const int * sources, int nb_sources, int inverse,
+	uint64_t * vus, int * ordre
+){
+	const int * debut = inverse ? graphe->debut_inverse : graphe->debut;
+	const int * voisins = inverse ? graphe->origines : graphe->fins;
+	int * file = ordre ? ordre : xmalloc( ( graphe->nb_etats + 1 ) * sizeof(int) );
+	int tete = 0, queue = 0;
+	int i, l, k;
+	for( i=0; i<nb_sources; i++ ){
+		int s = sources[i];
+		if( TESTER_BIT( vus, s ) ) continue;
+		METTRE_BIT( vus, s );
+		file[ queue++ ] = s;
+	}
+	while( tete < queue ){
+		int etat = file[ tete++ ];
+		for( l=0; l<graphe->nb_lettres; l++ ){
+			int cellule = etat * graphe->nb_lettres + l;
+			for( k=debut[cellule]; k<debut[cellule+1]; k++ ){
+				int v = voisins[k];
+				if( TESTER_BIT( vus, v ) ) continue;
+				METTRE_BIT( vus, v );
+				file[ queue++ ] = v;
+			}
+		}
+	}
+	if( ! ordre ) xfree( file );
+	return queue;
+}
@@ -0,0 +1,115 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2014, 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file graphe.h */ 
+
+#ifndef __GRAPHE_H__
+#define __GRAPHE_H__
+
+#include "automate.h"
+
+#include <stdint.h>
+
+/**
+ * @brief Index d'adjacence compact d'un automate.
+ *
+ * Les états de l'automate sont renumérotés de 0 à nb_etats-1 dans l'ordre 
+ * croissant, et les lettres de 0 à nb_lettres-1 dans l'ordre de l'alphabet.
+ * Les fins des transitions d'origine i et de lettre l sont les indices
+ * fins[ debut[i*nb_lettres+l] ] ... fins[ debut[i*nb_lettres+l+1] - 1 ],
+ * triés par ordre croissant.
+ *
+ * L'index est indépendant de l'automate du point de vue de la mémoire : il 
+ * n'est pas mis à jour si l'automate est modifié.
+ */
+typedef struct Graphe {
+	int nb_etats;
+	int * etats;                //!< Indice -> état, trié.
+	int nb_lettres;
+	char * lettres;             //!< Indice -> lettre, dans l'ordre de l'alphabet.
+	int indice_lettre[256];     //!< Lettre (unsigned char) -> indice, ou -1.
+	int nb_transitions;
+	int * debut;                //!< Taille nb_etats*nb_lettres+1.
+	int * fins;
+	int * debut_inverse;        //!< NULL tant que calculer_inverse_graphe() n'a pas été appelée.
+	int * origines;
+	int nb_initiaux;
+	int * initiaux;             //!< Indices des états initiaux.
+	char * final;               //!< final[i] vaut 1 si l'état d'indice i est final.
+} Graphe;
+
+/**
+ * @brief Construit l'index d'adjacence d'un automate.
+ *
+ * @param automate Un automate.
+ * @return L'index.
+ */
+Graphe * creer_graphe( const Automate * automate );
+
+/**
+ * @brief Détruit un index d'adjacence.
+ *
+ * @param graphe L'index à détruire.
+ */
+void liberer_graphe( Graphe * graphe );
+
+/**
+ * @brief Renvoie l'indice d'un état dans l'index, ou -1 si l'état n'est pas
+ *        un état de l'automate.
+ *
+ * @param graphe Un index.
+ * @param etat Un état.
+ * @return L'indice de l'état.
+ */
+int indice_etat_graphe( const Graphe * graphe, int etat );
+
+/**
+ * @brief Calcule l'index des transitions inverses.
+ *
+ * Les origines des transitions de fin i et de lettre l sont alors 
+ * origines[ debut_inverse[i*nb_lettres+l] ] ... 
+ * origines[ debut_inverse[i*nb_lettres+l+1] - 1 ].
+ * La fonction ne fait rien si l'index inverse est déjà calculé.
+ *
+ * @param graphe Un index.
+ */
+void calculer_inverse_graphe( Graphe * graphe );
+
+/**
+ * @brief Parcours en largeur depuis plusieurs sources, en temps linéaire.
+ *
+ * @param graphe Un index ; si 'inverse' est non nul, l'index inverse doit 
+ *        être calculé (voir calculer_inverse_graphe()).
+ * @param sources Les indices des états de départ.
+ * @param nb_sources Le nombre de sources.
+ * @param inverse Si non nul, les transitions sont suivies à rebours.
+ * @param vus Un ensemble de bits de NB_MOTS_BITS(nb_etats) mots (voir 
+ *        outils.h) : les états déjà marqués ne sont pas parcourus, et les 
+ *        états atteints sont marqués.
+ * @param ordre Si non NULL, reçoit les indices des états atteints dans 
+ *        l'ordre du parcours (au plus nb_etats indices).
+ * @return Le nombre d'états atteints.
+ */
+int parcourir_graphe(
+	const Graphe * graphe, const int * sources, int nb_sources, int inverse,
+	uint64_t * vus, int * ordre
+);
+
+#endif
@@ -0,0 +1,328 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2014, 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "inclusion.h"
+#include "graphe.h"
+#include "outils.h"
+
+#include <stdint.h>
+#include <string.h>
+
+/*
+ * Les couples (p, S) sont rangés dans l'ordre de leur création, qui est 
+ * aussi l'ordre du parcours en largeur : la file est la suite des couples.
+ * Pour chaque état p de A, 'couples_de[p]' liste les couples vivants de 
+ * l'antichaîne ; un couple couvert par un couple plus petit et de même 
+ * profondeur est marqué mort et n'est pas exploré. Un couple plus profond ne
+ * remplace pas un couple moins profond : le premier contre-exemple trouvé 
+ * donne ainsi un plus court mot, retrouvé par les liens vers les parents.
+ */
+typedef struct {
+	const Graphe * a;
+	const Graphe * b;
+	int nb_mots;                // Nombre de mots de 64 bits d'une partie.
+	int nb_couples;
+	int capacite;
+	int * etat;                 // État de A de chaque couple.
+	char * vivant;
+	int * parent;               // -1 pour un couple initial.
+	char * lettre;              // Lettre lue depuis le parent.
+	int * profondeur;
+	uint64_t * parties;         // nb_mots mots par couple.
+	int ** couples_de;
+	int * nb_couples_de;
+	int * capacite_couples_de;
+	uint64_t * finaux_b;
+} Antichaine;
+
+#define MEMOIRE_ESTIMEE_COUPLE_ANTICHAINE 32
+
+int partie_incluse_antichaine( 
+	const uint64_t * petite, const uint64_t * grande, int nb_mots 
+){
+	int i;
+	for( i=0; i<nb_mots; i++ ){
+		if( petite[i] & ~grande[i] ) return 0;
+	}
+	return 1;
+}
+
+/*
+ * Ajoute le couple (p, S) à l'antichaîne s'il n'est pas couvert par un 
+ * couple (p, S') avec S' inclus dans S ; les couples qu'il couvre meurent.
+ */
+void ajouter_couple_antichaine( 
+	Antichaine * ac, int p, const uint64_t * partie, int parent, char lettre 
+){
+	int profondeur = parent < 0 ? 0 : ac->profondeur[parent] + 1;
+	int * liste = ac->couples_de[p];
+	int i, j;
+	for( i=0; i<ac->nb_couples_de[p]; i++ ){
+		if( 
+			partie_incluse_antichaine( 
+				ac->parties + (size_t) liste[i] * ac->nb_mots, partie, ac->nb_mots 
+			) 
+		) return;
+	}
+	for( i=0, j=0; i<ac->nb_couples_de[p]; i++ ){
+		if( 
+			ac->profondeur[ liste[i] ] == profondeur
+			&& partie_incluse_antichaine( 
+				partie, ac->parties + (size_t) liste[i] * ac->nb_mots, ac->nb_mots 
+			) 
+		){
+			ac->vivant[ liste[i] ] = 0;
+		}else{
+			liste[ j++ ] = liste[i];
+		}
+	}
+	ac->nb_couples_de[p] = j;
+
+	if( ac->nb_couples == ac->capacite ){
+		ac->capacite *= 2;
+		ac->etat = xrealloc( ac->etat, ac->capacite * sizeof(int) );
+		ac->vivant = xrealloc( ac->vivant, ac->capacite );
+		ac->parent = xrealloc( ac->parent, ac->capacite * sizeof(int) );
+		ac->lettre = xrealloc( ac->lettre, ac->capacite );
+		ac->profondeur = xrealloc( ac->profondeur, ac->capacite * sizeof(int) );
+		ac->parties = xrealloc( 
+			ac->parties, (size_t) ac->capacite * ac->nb_mots * sizeof(uint64_t) 
+		);
+	}
+	int id = ac->nb_couples++;
+	ac->etat[id] = p;
+	ac->vivant[id] = 1;
+	ac->parent[id] = parent;
+	ac->lettre[id] = lettre;
+	ac->profondeur[id] = profondeur;
+	memcpy( 
+		ac->parties + (size_t) id * ac->nb_mots, partie, 
+		ac->nb_mots * sizeof(uint64_t) 
+	);
+	if( ac->nb_couples_de[p] == ac->capacite_couples_de[p] ){
+		ac->capacite_couples_de[p] = 2 * ac->capacite_couples_de[p] + 4;
+		ac->couples_de[p] = xrealloc( 
+			ac->couples_de[p], ac->capacite_couples_de[p] * sizeof(int) 
+		);
+	}
+	ac->couples_de[p][ ac->nb_couples_de[p]++ ] = id;
+}
+
+/*
+ * Un couple est un contre-exemple si son état est final dans A et si sa 
+ * partie ne contient aucun état final de B.
+ */
+int contre_exemple_antichaine( const Antichaine * ac, int id ){
+	if( ! ac->a->final[ ac->etat[id] ] ) return 0;
+	const uint64_t * partie = ac->parties + (size_t) id * ac->nb_mots;
+	int i;
+	for( i=0; i<ac->nb_mots; i++ ){
+		if( partie[i] & ac->finaux_b[i] ) return 0;
+	}
+	return 1;
+}
+
+/*
+ * Le mot qui mène au couple 'id'.
+ */
+char * mot_antichaine( const Antichaine * ac, int id ){
+	int longueur = ac->profondeur[id];
+	char * mot = xmalloc( longueur + 1 );
+	mot[longueur] = '\0';
+	for( ; ac->parent[id] >= 0; id=ac->parent[id] ){
+		mot[ --longueur ] = ac->lettre[id];
+	}
+	return mot;
+}
+
+Statut_budget inclusion_graphes( 
+	const Graphe * a, const Graphe * b, Budget * budget, bool * resultat,
+	char ** mot
+){
+	Antichaine ac;
+	ac.a = a;
+	ac.b = b;
+	ac.nb_mots = NB_MOTS_BITS( b->nb_etats ) > 0 ? NB_MOTS_BITS( b->nb_etats ) : 1;
+	ac.nb_couples = 0;
+	ac.capacite = 16;
+	ac.etat = xmalloc( ac.capacite * sizeof(int) );
+	ac.vivant = xmalloc( ac.capacite );
+	ac.parent = xmalloc( ac.capacite * sizeof(int) );
+	ac.lettre = xmalloc( ac.capacite );
+	ac.profondeur = xmalloc( ac.capacite * sizeof(int) );
+	ac.parties = xmalloc( (size_t) ac.capacite * ac.nb_mots * sizeof(uint64_t) );
+	ac.couples_de = xmalloc( ( a->nb_etats + 1 ) * sizeof(int*) );
+	ac.nb_couples_de = xmalloc( ( a->nb_etats + 1 ) * sizeof(int) );
+	ac.capacite_couples_de = xmalloc( ( a->nb_etats + 1 ) * sizeof(int) );
+	ac.finaux_b = xmalloc( ac.nb_mots * sizeof(uint64_t) );
+	uint64_t * image = xmalloc( ac.nb_mots * sizeof(uint64_t) );
+	int i, l, t;
+	for( i=0; i<a->nb_etats; i++ ){
+		ac.couples_de[i] = NULL;
+		ac.nb_couples_de[i] = 0;
+		ac.capacite_couples_de[i] = 0;
+	}
+	memset( ac.finaux_b, 0, ac.nb_mots * sizeof(uint64_t) );
+	for( i=0; i<b->nb_etats; i++ ){
+		if( b->final[i] ) METTRE_BIT( ac.finaux_b, i );
+	}
+
+	// Couples initiaux : (p, I_B) pour chaque état initial p de A.
+	memset( image, 0, ac.nb_mots * sizeof(uint64_t) );
+	for( i=0; i<b->nb_initiaux; i++ ){
+		METTRE_BIT( image, b->initiaux[i] );
+	}
+	for( i=0; i<a->nb_initiaux; i++ ){
+		ajouter_couple_antichaine( &ac, a->initiaux[i], image, -1, 0 );
+	}
+
+	Statut_budget statut = BUDGET_RESPECTE;
+	int inclus = 1;
+	if( mot ) *mot = NULL;
+	int prochain;
+	for( prochain=0; prochain<ac.nb_couples && inclus; prochain++ ){
+		if( ! ac.vivant[prochain] ) continue;
+		if( contre_exemple_antichaine( &ac, prochain ) ){
+			inclus = 0;
+			if( mot ) *mot = mot_antichaine( &ac, prochain );
+			break;
+		}
+		statut = verifier_budget( 
+			budget, ac.nb_couples, 
+			(size_t) ac.nb_couples * 
+				( MEMOIRE_ESTIMEE_COUPLE_ANTICHAINE + ac.nb_mots * sizeof(uint64_t) )
+		);
+		if( statut != BUDGET_RESPECTE ) break;
+
+		int p = ac.etat[prochain];
+		for( l=0; l<a->nb_lettres; l++ ){
+			int cellule = p * a->nb_lettres + l;
+			if( a->debut[cellule] == a->debut[cellule+1] ) continue;
+
+			// Image de la partie par la lettre dans B.
+			memset( image, 0, ac.nb_mots * sizeof(uint64_t) );
+			int lb = b->indice_lettre[ (unsigned char) a->lettres[l] ];
+			if( lb >= 0 ){
+				const uint64_t * partie = ac.parties + (size_t) prochain * ac.nb_mots;
+				int m;
+				for( m=0; m<ac.nb_mots; m++ ){
+					uint64_t mot = partie[m];
+					while( mot ){
+						int q = m * 64 + __builtin_ctzll( mot );
+						mot &= mot - 1;
+						int cellule_b = q * b->nb_lettres + lb;
+						for( t=b->debut[cellule_b]; t<b->debut[cellule_b+1]; t++ ){
+							METTRE_BIT( image, b->fins[t] );
+						}
+					}
+				}
+			}
+
+			// Le couple courant peut avoir été couvert entre-temps : ses 
+			// successeurs restent corrects, l'antichaîne fait le tri.
+			for( t=a->debut[cellule]; t<a->debut[cellule+1]; t++ ){
+				ajouter_couple_antichaine( &ac, a->fins[t], image, prochain, a->lettres[l] );
+			}
+		}
+	}
+
+	if( statut == BUDGET_RESPECTE ) *resultat = inclus;
+	for( i=0; i<a->nb_etats; i++ ) xfree( ac.couples_de[i] );
+	xfree( ac.couples_de );
+	xfree( ac.nb_couples_de );
+	xfree( ac.capacite_couples_de );
+	xfree( ac.etat );
+	xfree( ac.vivant );
+	xfree( ac.parent );
+	xfree( ac.lettre );
+	xfree( ac.profondeur );
+	xfree( ac.parties );
+	xfree( ac.finaux_b );
+	xfree( image );
+	return statut;
+}
+
+Statut_budget est_inclus_budget( 
+	const Automate * a, const Automate * b, Budget * budget, bool * resultat 
+){
+	Graphe * ga = creer_graphe( a );
+	Graphe * gb = creer_graphe( b );
+	Statut_budget statut = inclusion_graphes( ga, gb, budget, resultat, NULL );
+	liberer_graphe( ga );
+	liberer_graphe( gb );
+	return statut;
+}
+
+bool est_inclus_temoin( const Automate * a, const Automate * b, char ** mot ){
+	Graphe * ga = creer_graphe( a );
+	Graphe * gb = creer_graphe( b );
+	bool resultat = false;
+	inclusion_graphes( ga, gb, NULL, &resultat, mot );
+	liberer_graphe( ga );
+	liberer_graphe( gb );
+	return resultat;
+}
+
+bool est_inclus( const Automate * a, const Automate * b ){
+	bool resultat = false;
+	est_inclus_budget( a, b, NULL, &resultat );
+	return resultat;
+}
+
+/*
+ * L'automate à un état qui reconnaît tous les mots sur l'alphabet d'un 
+ * automate.
+ */
+Automate * automate_tous_les_mots( const Automate * automate ){
+	Automate * tout = creer_automate();
+	ajouter_etat_initial( tout, 0 );
+	ajouter_etat_final( tout, 0 );
+	Ensemble_iterateur it;
+	for( 
+		it = premier_iterateur_ensemble( get_alphabet( automate ) );
+		! iterateur_ensemble_est_vide( it );
+		it = iterateur_suivant_ensemble( it )
+	){
+		ajouter_transition( tout, 0, get_element( it ), 0 );
+	}
+	return tout;
+}
+
+Statut_budget est_universel_budget( 
+	const Automate * automate, Budget * budget, bool * resultat 
+){
+	Automate * tout = automate_tous_les_mots( automate );
+	Statut_budget statut = est_inclus_budget( tout, automate, budget, resultat );
+	liberer_automate( tout );
+	return statut;
+}
+
+bool est_universel( const Automate * automate ){
+	bool resultat = false;
+	est_universel_budget( automate, NULL, &resultat );
+	return resultat;
+}
+
+bool est_universel_temoin( const Automate * automate, char ** mot ){
+	Automate * tout = automate_tous_les_mots( automate );
+	bool resultat = est_inclus_temoin( tout, automate, mot );
+	liberer_automate( tout );
+	return resultat;
+}
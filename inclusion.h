@@ -0,0 +1,102 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2014, 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file inclusion.h */ 
+
+#ifndef __INCLUSION_H__
+#define __INCLUSION_H__
+
+#include "automate.h"
+
+#include <stdbool.h>
+
+/**
+ * @brief Teste si le langage d'un automate est inclus dans celui d'un autre.
+ *
+ * Les couples (état de A, partie des états de B) sont explorés en largeur 
+ * sans déterminiser B : seuls les couples minimaux pour l'inclusion des 
+ * parties sont conservés (antichaîne), car un couple dont la partie en 
+ * contient une autre, avec le même état de A, ne peut pas mener plus vite à 
+ * un contre-exemple. L'exploration s'arrête au premier couple dont l'état 
+ * est final dans A et dont la partie ne contient aucun état final de B.
+ *
+ * @param a L'automate A.
+ * @param b L'automate B.
+ * @return true si L(A) est inclus dans L(B).
+ */
+bool est_inclus( const Automate * a, const Automate * b );
+
+/**
+ * @brief Comme est_inclus(), sans dépasser un budget (voir budget.h).
+ *
+ * Le nombre d'états compté est le nombre de couples conservés.
+ *
+ * @param a L'automate A.
+ * @param b L'automate B.
+ * @param budget Le budget, ou NULL.
+ * @param resultat Reçoit le résultat si le budget est respecté.
+ * @return BUDGET_RESPECTE, ou la raison de l'abandon.
+ */
+Statut_budget est_inclus_budget( 
+	const Automate * a, const Automate * b, Budget * budget, bool * resultat 
+);
+
+/**
+ * @brief Comme est_inclus(), en donnant un plus court contre-exemple.
+ *
+ * @param a L'automate A.
+ * @param b L'automate B.
+ * @param mot Si non NULL, reçoit NULL si L(A) est inclus dans L(B), et sinon
+ *        un plus court mot de L(A) qui n'est pas dans L(B), à libérer avec 
+ *        xfree().
+ * @return true si L(A) est inclus dans L(B).
+ */
+bool est_inclus_temoin( const Automate * a, const Automate * b, char ** mot );
+
+/**
+ * @brief Teste si un automate reconnaît tous les mots sur son alphabet.
+ *
+ * C'est l'inclusion du langage de tous les mots sur l'alphabet de 
+ * l'automate dans celui de l'automate.
+ *
+ * @param automate L'automate.
+ * @return true si l'automate est universel.
+ */
+bool est_universel( const Automate * automate );
+
+/**
+ * @brief Comme est_universel(), sans dépasser un budget (voir budget.h).
+ */
+Statut_budget est_universel_budget( 
+	const Automate * automate, Budget * budget, bool * resultat 
+);
+
+/**
+ * @brief Comme est_universel(), en donnant un plus court mot non reconnu.
+ *
+ * @param automate L'automate.
+ * @param mot Si non NULL, reçoit NULL si l'automate est universel, et sinon 
+ *        un plus court mot sur son alphabet qu'il ne reconnaît pas, à libérer
+ *        avec xfree().
+ * @return true si l'automate est universel.
+ */
+bool est_universel_temoin( const Automate * automate, char ** mot );
+
+#endif
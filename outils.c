@@ -39,6 +39,31 @@ void* xmalloc( size_t n ){
 	return result;
 }
 
+void* xrealloc( void* ptr, size_t n ){
+	void* result = realloc( ptr, n );
+	if( ! result && n ){
+		ERREUR( "Espace insuffisant" );
+	}
+	return result;
+}
+
 void xfree( void* ptr ){
 	free(ptr);
 }
+
+uint64_t alea_suivant( uint64_t * etat ){
+	uint64_t z = ( *etat += 0x9E3779B97F4A7C15ULL );
+	z = ( z ^ ( z >> 30 ) ) * 0xBF58476D1CE4E5B9ULL;
+	z = ( z ^ ( z >> 27 ) ) * 0x94D049BB133111EBULL;
+	return z ^ ( z >> 31 );
+}
+
+uint64_t alea_borne( uint64_t * etat, uint64_t n ){
+	// Rejet des tirages qui biaiseraient le modulo.
+	uint64_t limite = -n % n;
+	uint64_t x;
+	do {
+		x = alea_suivant( etat );
+	} while( x < limite );
+	return x % n;
+}
@@ -25,12 +25,14 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <stdint.h>
 
 #define DEBUG(x) do { fprintf(stderr,"DEBUG : %s - ligne : %d, fichier : %s\n", (x), __LINE__, __FILE__ ); } while(0)
 #define DEBUGO(x) do { fprintf(stdout,"DEBUG : %s - ligne : %d, fichier : %s\n", (x), __LINE__, __FILE__ ); } while(0)
 #define ERREUR(x) do { fprintf(stderr,"ERREUR : %s - ligne : %d, fichier : %s\n", (x), __LINE__, __FILE__ ); exit(EXIT_FAILURE); } while(0)
 
 void* xmalloc( size_t n );
+void* xrealloc( void* ptr, size_t n );
 void xfree( void* ptr );
 
 #define TEST(y,x) do { x &= (y); if(!(y)){ fprintf(stdout, "\033[31mEchec du test %s() -- ligne : %d, fichier : %s\033[0m\n", __FUNCTION__, __LINE__, __FILE__ ); } } while(0)
@@ -41,5 +43,24 @@ void xfree( void* ptr );
 
 int test( int result, int ligne );
 
+/*
+ * Manipulation d'ensembles de bits stockés dans des tableaux de uint64_t.
+ */
+#define NB_MOTS_BITS(n) ( ( (size_t) (n) + 63 ) / 64 )
+#define TESTER_BIT(t,i) ( ( (t)[ (i) >> 6 ] >> ( (i) & 63 ) ) & 1 )
+#define METTRE_BIT(t,i) do { (t)[ (i) >> 6 ] |= (uint64_t) 1 << ( (i) & 63 ); } while(0)
+#define EFFACER_BIT(t,i) do { (t)[ (i) >> 6 ] &= ~( (uint64_t) 1 << ( (i) & 63 ) ); } while(0)
+
+/*
+ * Générateur pseudo-aléatoire splitmix64 : l'état est une graine 
+ * quelconque, mise à jour à chaque tirage.
+ */
+uint64_t alea_suivant( uint64_t * etat );
+
+/*
+ * Renvoie un entier uniforme dans [0, n[ (n > 0).
+ */
+uint64_t alea_borne( uint64_t * etat, uint64_t n );
+
 #endif
 
@@ -0,0 +1,139 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2014, 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "plus_courts_mots.h"
+#include "graphe.h"
+#include "outils.h"
+
+/*
+ * Distances aux états finaux, par indice d'état du graphe.
+ */
+void distances_graphe( Graphe * g, int * distance ){
+	calculer_inverse_graphe( g );
+	int * file = xmalloc( ( g->nb_etats + 1 ) * sizeof(int) );
+	int tete = 0, queue = 0;
+	int i, l, k;
+	for( i=0; i<g->nb_etats; i++ ){
+		distance[i] = -1;
+		if( g->final[i] ){
+			distance[i] = 0;
+			file[ queue++ ] = i;
+		}
+	}
+	while( tete < queue ){
+		int fin = file[ tete++ ];
+		for( l=0; l<g->nb_lettres; l++ ){
+			int cellule = fin * g->nb_lettres + l;
+			for( k=g->debut_inverse[cellule]; k<g->debut_inverse[cellule+1]; k++ ){
+				int origine = g->origines[k];
+				if( distance[origine] < 0 ){
+					distance[origine] = distance[fin] + 1;
+					file[ queue++ ] = origine;
+				}
+			}
+		}
+	}
+	xfree( file );
+}
+
+int * distances_aux_finaux( const Automate * automate, int * taille ){
+	Graphe * g = creer_graphe( automate );
+	int * distance = xmalloc( ( g->nb_etats + 1 ) * sizeof(int) );
+	distances_graphe( g, distance );
+	*taille = g->nb_etats ? g->etats[ g->nb_etats - 1 ] + 1 : 0;
+	int * res = xmalloc( ( *taille + 1 ) * sizeof(int) );
+	int i;
+	for( i=0; i<*taille; i++ ) res[i] = -1;
+	for( i=0; i<g->nb_etats; i++ ) res[ g->etats[i] ] = distance[i];
+	xfree( distance );
+	liberer_graphe( g );
+	return res;
+}
+
+char * plus_court_mot( const Automate * automate ){
+	Graphe * g = creer_graphe( automate );
+	int * distance = xmalloc( ( g->nb_etats + 1 ) * sizeof(int) );
+	distances_graphe( g, distance );
+
+	int i, j, l, k;
+	int longueur = -1;
+	for( i=0; i<g->nb_initiaux; i++ ){
+		int d = distance[ g->initiaux[i] ];
+		if( d >= 0 && ( longueur < 0 || d < longueur ) ) longueur = d;
+	}
+	char * mot = NULL;
+	if( longueur >= 0 ){
+		// Chaque pas suit la plus petite lettre qui rapproche d'un état final 
+		// depuis l'un des états courants, et garde toutes ses images à la 
+		// bonne distance : les couches de distances différentes sont 
+		// disjointes, le tout reste linéaire.
+		int * courants = xmalloc( ( g->nb_etats + 1 ) * sizeof(int) );
+		int * suivants = xmalloc( ( g->nb_etats + 1 ) * sizeof(int) );
+		int * couche = xmalloc( ( g->nb_etats + 1 ) * sizeof(int) );
+		for( i=0; i<g->nb_etats; i++ ) couche[i] = -1;
+		int nb_courants = 0;
+		for( i=0; i<g->nb_initiaux; i++ ){
+			int initial = g->initiaux[i];
+			if( distance[initial] == longueur && couche[initial] < 0 ){
+				couche[initial] = 0;
+				courants[ nb_courants++ ] = initial;
+			}
+		}
+		mot = xmalloc( longueur + 1 );
+		for( i=0; i<longueur; i++ ){
+			int nb_suivants = 0;
+			for( l=0; l<g->nb_lettres && nb_suivants == 0; l++ ){
+				for( j=0; j<nb_courants; j++ ){
+					int cellule = courants[j] * g->nb_lettres + l;
+					for( k=g->debut[cellule]; k<g->debut[cellule+1]; k++ ){
+						int fin = g->fins[k];
+						if( 
+							distance[fin] == longueur - i - 1 
+							&& couche[fin] != i + 1 
+						){
+							couche[fin] = i + 1;
+							suivants[ nb_suivants++ ] = fin;
+						}
+					}
+				}
+				if( nb_suivants > 0 ) mot[i] = g->lettres[l];
+			}
+			int * echange = courants;
+			courants = suivants;
+			suivants = echange;
+			nb_courants = nb_suivants;
+		}
+		mot[longueur] = '\0';
+		xfree( courants );
+		xfree( suivants );
+		xfree( couche );
+	}
+	xfree( distance );
+	liberer_graphe( g );
+	return mot;
+}
+
+bool langage_est_vide( const Automate * automate, char ** mot ){
+	char * temoin = plus_court_mot( automate );
+	bool vide = temoin == NULL;
+	if( mot ) *mot = temoin;
+	else xfree( temoin );
+	return vide;
+}
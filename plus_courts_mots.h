@@ -0,0 +1,69 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2014, 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file plus_courts_mots.h */ 
+
+#ifndef __PLUS_COURTS_MOTS_H__
+#define __PLUS_COURTS_MOTS_H__
+
+#include "automate.h"
+
+#include <stdbool.h>
+
+/**
+ * @brief Calcule, pour chaque état, la longueur d'un plus court mot qui mène
+ *        de cet état à un état final.
+ *
+ * Le calcul est un parcours en largeur des transitions inversées depuis les
+ * états finaux, en temps linéaire en la taille de l'automate.
+ *
+ * @param automate Un automate, dont les états sont des entiers positifs.
+ * @param taille Reçoit la taille du tableau renvoyé : le plus grand état 
+ *        plus un.
+ * @return Un tableau, à libérer avec xfree(), qui à chaque état associe sa 
+ *         distance aux états finaux, ou -1 si aucun état final n'est 
+ *         accessible depuis cet état (ou si ce n'est pas un état).
+ */
+int * distances_aux_finaux( const Automate * automate, int * taille );
+
+/**
+ * @brief Renvoie un plus court mot reconnu par un automate.
+ *
+ * Parmi les plus courts mots, c'est le plus petit dans l'ordre de l'alphabet,
+ * y compris pour un automate non déterministe : chaque lettre est choisie 
+ * depuis l'ensemble des états atteints par le préfixe déjà construit, en 
+ * temps linéaire en la taille de l'automate.
+ *
+ * @param automate Un automate.
+ * @return Le mot, à libérer avec xfree(), ou NULL si le langage est vide.
+ */
+char * plus_court_mot( const Automate * automate );
+
+/**
+ * @brief Teste si le langage d'un automate est vide.
+ *
+ * @param automate Un automate.
+ * @param mot Si non NULL, reçoit NULL si le langage est vide, et sinon un plus
+ *        court mot reconnu (voir plus_court_mot()), à libérer avec xfree().
+ * @return true si le langage est vide.
+ */
+bool langage_est_vide( const Automate * automate, char ** mot );
+
+#endif
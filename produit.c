@@ -0,0 +1,568 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2014, 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "produit.h"
+#include "graphe.h"
+#include "vecteurs.h"
+#include "concurrent.h"
+#include "outils.h"
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*
+ * Les n-uplets sont des vecteurs d'indices (voir graphe.h), internés dans 
+ * une table de vecteurs : leur numéro d'internement est leur numéro dans le
+ * produit, et la file du parcours en largeur est la suite des numéros.
+ */
+typedef struct {
+	int nb;
+	Graphe ** graphes;
+	Automate * res;
+	Table_vecteurs * n_uplets;
+	int * etats;                // Tampon pour la fonction d'arrêt.
+	Arret_produit arret;
+	void * data;
+	int interrompu;
+} Produit;
+
+/*
+ * Range dans lettres[] les lettres communes à tous les automates, dans 
+ * l'ordre de l'alphabet, et dans indices[c*nb+k] l'indice de la lettre c 
+ * dans le k-ième graphe ; renvoie le nombre de lettres communes.
+ */
+int lettres_communes_produit( 
+	Graphe * const * graphes, int nb, char * lettres, int * indices 
+){
+	int nb_lettres = 0;
+	int l, k;
+	for( l=0; l<graphes[0]->nb_lettres; l++ ){
+		unsigned char lettre = graphes[0]->lettres[l];
+		int commune = 1;
+		for( k=0; k<nb; k++ ){
+			indices[ nb_lettres*nb + k ] = graphes[k]->indice_lettre[lettre];
+			commune &= indices[ nb_lettres*nb + k ] >= 0;
+		}
+		if( commune ) lettres[ nb_lettres++ ] = lettre;
+	}
+	return nb_lettres;
+}
+
+int ajouter_n_uplet_produit( Produit * p, const uint64_t * n_uplet ){
+	int nouveau;
+	int id = interner_vecteur( p->n_uplets, n_uplet, p->nb, &nouveau );
+	if( ! nouveau ) return id;
+
+	ajouter_etat( p->res, id );
+	int k;
+	int final = 1;
+	for( k=0; k<p->nb; k++ ){
+		final &= p->graphes[k]->final[ n_uplet[k] ];
+		p->etats[k] = p->graphes[k]->etats[ n_uplet[k] ];
+	}
+	if( final ){
+		ajouter_etat_final( p->res, id );
+		if( p->arret && p->arret( id, p->etats, p->nb, p->data ) ){
+			p->interrompu = 1;
+		}
+	}
+	return id;
+}
+
+Automate * creer_produit_des_automates(
+	const Automate * const * automates, int nb_automates,
+	Arret_produit arret, void * data, int * interrompu
+){
+	Produit p;
+	p.nb = nb_automates;
+	p.graphes = xmalloc( nb_automates * sizeof(Graphe*) );
+	p.res = creer_automate();
+	p.n_uplets = creer_table_vecteurs();
+	p.etats = xmalloc( nb_automates * sizeof(int) );
+	p.arret = arret;
+	p.data = data;
+	p.interrompu = 0;
+
+	int k, l, c;
+	for( k=0; k<nb_automates; k++ ){
+		p.graphes[k] = creer_graphe( automates[k] );
+		for( l=0; l<p.graphes[k]->nb_lettres; l++ ){
+			ajouter_lettre( p.res, p.graphes[k]->lettres[l] );
+		}
+	}
+
+	char lettres[256];
+	int * indices = xmalloc( 256 * nb_automates * sizeof(int) );
+	int nb_lettres = lettres_communes_produit( p.graphes, nb_automates, lettres, indices );
+
+	uint64_t * n_uplet = xmalloc( nb_automates * sizeof(uint64_t) );
+	uint64_t * origine = xmalloc( nb_automates * sizeof(uint64_t) );
+	int * position = xmalloc( nb_automates * sizeof(int) );
+	int * debut = xmalloc( nb_automates * sizeof(int) );
+	int * fin = xmalloc( nb_automates * sizeof(int) );
+
+	// Les n-uplets d'états initiaux.
+	int vide = 0;
+	for( k=0; k<nb_automates; k++ ){
+		position[k] = 0;
+		vide |= p.graphes[k]->nb_initiaux == 0;
+	}
+	while( ! vide && ! p.interrompu ){
+		for( k=0; k<nb_automates; k++ ){
+			n_uplet[k] = p.graphes[k]->initiaux[ position[k] ];
+		}
+		ajouter_etat_initial( p.res, ajouter_n_uplet_produit( &p, n_uplet ) );
+		for( k=nb_automates-1; k>=0; k-- ){
+			if( ++position[k] < p.graphes[k]->nb_initiaux ) break;
+			position[k] = 0;
+		}
+		if( k < 0 ) break;
+	}
+
+	// Parcours en largeur.
+	int prochain;
+	for( 
+		prochain = 0; 
+		prochain < taille_table_vecteurs( p.n_uplets ) && ! p.interrompu; 
+		prochain++ 
+	){
+		int nb_mots;
+		memcpy( 
+			origine, get_vecteur( p.n_uplets, prochain, &nb_mots ), 
+			nb_automates * sizeof(uint64_t) 
+		);
+		for( c=0; c<nb_lettres && ! p.interrompu; c++ ){
+			vide = 0;
+			for( k=0; k<nb_automates; k++ ){
+				const Graphe * g = p.graphes[k];
+				int cellule = (int) origine[k] * g->nb_lettres + indices[ c*nb_automates + k ];
+				debut[k] = g->debut[cellule];
+				fin[k] = g->debut[cellule+1];
+				position[k] = debut[k];
+				vide |= debut[k] == fin[k];
+			}
+			while( ! vide && ! p.interrompu ){
+				for( k=0; k<nb_automates; k++ ){
+					n_uplet[k] = p.graphes[k]->fins[ position[k] ];
+				}
+				int id = ajouter_n_uplet_produit( &p, n_uplet );
+				ajouter_transition( p.res, prochain, lettres[c], id );
+				for( k=nb_automates-1; k>=0; k-- ){
+					if( ++position[k] < fin[k] ) break;
+					position[k] = debut[k];
+				}
+				if( k < 0 ) break;
+			}
+		}
+	}
+
+	if( interrompu ) *interrompu = p.interrompu;
+	xfree( n_uplet );
+	xfree( origine );
+	xfree( position );
+	xfree( debut );
+	xfree( fin );
+	xfree( indices );
+	xfree( p.etats );
+	for( k=0; k<nb_automates; k++ ) liberer_graphe( p.graphes[k] );
+	xfree( p.graphes );
+	liberer_table_vecteurs( p.n_uplets );
+	return p.res;
+}
+
+/*
+ * Produit parallèle.
+ *
+ * Le parcours en largeur est synchronisé par niveau : les threads se 
+ * partagent les n-uplets de la frontière par blocs, internent leurs 
+ * successeurs dans une table concurrente et ajoutent les nouveaux à leur 
+ * part de la frontière suivante. Chaque thread note, pour chaque n-uplet 
+ * traité, son caractère final et ses transitions dans l'ordre du parcours 
+ * séquentiel. Le produit est ensuite construit en rejouant ce parcours : 
+ * la numérotation est celle de creer_produit_des_automates().
+ */
+
+#define TAILLE_BLOC_PRODUIT 64
+
+typedef struct {
+	int nb;
+	Graphe ** graphes;
+	int nb_lettres;
+	const int * indices;
+	Table_vecteurs_concurrente * n_uplets;
+	Barriere * barriere;
+
+	// Frontière : pour chaque n-uplet, son numéro puis ses nb états.
+	uint64_t * frontiere;
+	size_t taille_frontiere;
+	atomic_size_t prochain_bloc;
+	int fini;
+} Produit_parallele;
+
+typedef struct {
+	Produit_parallele * produit;
+	pthread_t thread;
+	uint64_t * suivante;
+	size_t taille_suivante;
+	size_t capacite_suivante;
+	// Pour chaque n-uplet traité : numéro, final, nombre de transitions, 
+	// puis (indice de lettre, numéro de la fin) pour chaque transition.
+	int * releves;
+	size_t nb_releves;
+	size_t capacite_releves;
+} Ouvrier_produit;
+
+void reserver_releves_produit( Ouvrier_produit * o, size_t nb ){
+	if( o->nb_releves + nb > o->capacite_releves ){
+		while( o->nb_releves + nb > o->capacite_releves ) o->capacite_releves *= 2;
+		o->releves = xrealloc( o->releves, o->capacite_releves * sizeof(int) );
+	}
+}
+
+void traiter_n_uplet_produit( 
+	Ouvrier_produit * o, const uint64_t * enregistrement,
+	uint64_t * n_uplet, int * position, int * debut, int * fin
+){
+	Produit_parallele * p = o->produit;
+	const uint64_t * origine = enregistrement + 1;
+	int k, c;
+
+	reserver_releves_produit( o, 3 );
+	size_t entete = o->nb_releves;
+	o->nb_releves += 3;
+	int final = 1;
+	for( k=0; k<p->nb; k++ ) final &= p->graphes[k]->final[ origine[k] ];
+	o->releves[entete] = (int) enregistrement[0];
+	o->releves[entete+1] = final;
+	o->releves[entete+2] = 0;
+
+	for( c=0; c<p->nb_lettres; c++ ){
+		int vide = 0;
+		for( k=0; k<p->nb; k++ ){
+			const Graphe * g = p->graphes[k];
+			int cellule = (int) origine[k] * g->nb_lettres + p->indices[ c*p->nb + k ];
+			debut[k] = g->debut[cellule];
+			fin[k] = g->debut[cellule+1];
+			position[k] = debut[k];
+			vide |= debut[k] == fin[k];
+		}
+		while( ! vide ){
+			for( k=0; k<p->nb; k++ ){
+				n_uplet[k] = p->graphes[k]->fins[ position[k] ];
+			}
+			int nouveau;
+			int id = interner_vecteur_concurrent( p->n_uplets, n_uplet, p->nb, &nouveau );
+			if( nouveau ){
+				if( o->taille_suivante + p->nb + 1 > o->capacite_suivante ){
+					while( o->taille_suivante + p->nb + 1 > o->capacite_suivante ){
+						o->capacite_suivante *= 2;
+					}
+					o->suivante = xrealloc( 
+						o->suivante, o->capacite_suivante * sizeof(uint64_t) 
+					);
+				}
+				o->suivante[ o->taille_suivante ] = id;
+				memcpy( 
+					o->suivante + o->taille_suivante + 1, n_uplet, 
+					p->nb * sizeof(uint64_t) 
+				);
+				o->taille_suivante += p->nb + 1;
+			}
+			reserver_releves_produit( o, 2 );
+			o->releves[ o->nb_releves++ ] = c;
+			o->releves[ o->nb_releves++ ] = id;
+			o->releves[entete+2]++;
+			for( k=p->nb-1; k>=0; k-- ){
+				if( ++position[k] < fin[k] ) break;
+				position[k] = debut[k];
+			}
+			if( k < 0 ) break;
+		}
+	}
+}
+
+void * travailler_produit( void * argument ){
+	Ouvrier_produit * o = argument;
+	Produit_parallele * p = o->produit;
+	uint64_t * n_uplet = xmalloc( p->nb * sizeof(uint64_t) );
+	int * position = xmalloc( p->nb * sizeof(int) );
+	int * debut = xmalloc( p->nb * sizeof(int) );
+	int * fin = xmalloc( p->nb * sizeof(int) );
+	size_t largeur = p->nb + 1;
+
+	while( 1 ){
+		attendre_barriere( p->barriere );
+		if( p->fini ) break;
+		while( 1 ){
+			size_t bloc = atomic_fetch_add( &p->prochain_bloc, 1 );
+			size_t premier = bloc * TAILLE_BLOC_PRODUIT;
+			if( premier >= p->taille_frontiere ) break;
+			size_t dernier = premier + TAILLE_BLOC_PRODUIT;
+			if( dernier > p->taille_frontiere ) dernier = p->taille_frontiere;
+			size_t i;
+			for( i=premier; i<dernier; i++ ){
+				traiter_n_uplet_produit( 
+					o, p->frontiere + i * largeur, n_uplet, position, debut, fin 
+				);
+			}
+		}
+		attendre_barriere( p->barriere );
+	}
+
+	xfree( n_uplet );
+	xfree( position );
+	xfree( debut );
+	xfree( fin );
+	return NULL;
+}
+
+Automate * creer_produit_des_automates_parallele(
+	const Automate * const * automates, int nb_automates, int nb_threads
+){
+	if( nb_threads < 1 ) nb_threads = 1;
+	Produit_parallele p;
+	p.nb = nb_automates;
+	p.graphes = xmalloc( nb_automates * sizeof(Graphe*) );
+	Automate * res = creer_automate();
+	int i, k, l;
+	for( k=0; k<nb_automates; k++ ){
+		p.graphes[k] = creer_graphe( automates[k] );
+		for( l=0; l<p.graphes[k]->nb_lettres; l++ ){
+			ajouter_lettre( res, p.graphes[k]->lettres[l] );
+		}
+	}
+	char lettres[256];
+	int * indices = xmalloc( 256 * nb_automates * sizeof(int) );
+	p.nb_lettres = lettres_communes_produit( p.graphes, nb_automates, lettres, indices );
+	p.indices = indices;
+	p.n_uplets = creer_table_vecteurs_concurrente( 4 * nb_threads );
+	p.barriere = creer_barriere( nb_threads );
+	p.fini = 0;
+	size_t largeur = nb_automates + 1;
+
+	// Les n-uplets d'états initiaux forment la première frontière.
+	int nb_initiaux = 0;
+	int capacite_initiaux = 16;
+	int * initiaux = xmalloc( capacite_initiaux * sizeof(int) );
+	size_t capacite_frontiere = 16 * largeur;
+	p.frontiere = xmalloc( capacite_frontiere * sizeof(uint64_t) );
+	p.taille_frontiere = 0;
+	uint64_t * n_uplet = xmalloc( nb_automates * sizeof(uint64_t) );
+	int * position = xmalloc( nb_automates * sizeof(int) );
+	int vide = 0;
+	for( k=0; k<nb_automates; k++ ){
+		position[k] = 0;
+		vide |= p.graphes[k]->nb_initiaux == 0;
+	}
+	while( ! vide ){
+		for( k=0; k<nb_automates; k++ ){
+			n_uplet[k] = p.graphes[k]->initiaux[ position[k] ];
+		}
+		int nouveau;
+		int id = interner_vecteur_concurrent( p.n_uplets, n_uplet, nb_automates, &nouveau );
+		if( nb_initiaux == capacite_initiaux ){
+			capacite_initiaux *= 2;
+			initiaux = xrealloc( initiaux, capacite_initiaux * sizeof(int) );
+		}
+		initiaux[ nb_initiaux++ ] = id;
+		if( nouveau ){
+			if( ( p.taille_frontiere + 1 ) * largeur > capacite_frontiere ){
+				capacite_frontiere *= 2;
+				p.frontiere = xrealloc( p.frontiere, capacite_frontiere * sizeof(uint64_t) );
+			}
+			p.frontiere[ p.taille_frontiere * largeur ] = id;
+			memcpy( 
+				p.frontiere + p.taille_frontiere * largeur + 1, n_uplet, 
+				nb_automates * sizeof(uint64_t) 
+			);
+			p.taille_frontiere++;
+		}
+		for( k=nb_automates-1; k>=0; k-- ){
+			if( ++position[k] < p.graphes[k]->nb_initiaux ) break;
+			position[k] = 0;
+		}
+		if( k < 0 ) break;
+	}
+	xfree( n_uplet );
+	xfree( position );
+
+	Ouvrier_produit * ouvriers = xmalloc( nb_threads * sizeof(Ouvrier_produit) );
+	for( i=0; i<nb_threads; i++ ){
+		ouvriers[i].produit = &p;
+		ouvriers[i].capacite_suivante = 16 * largeur;
+		ouvriers[i].taille_suivante = 0;
+		ouvriers[i].suivante = xmalloc( ouvriers[i].capacite_suivante * sizeof(uint64_t) );
+		ouvriers[i].capacite_releves = 64;
+		ouvriers[i].nb_releves = 0;
+		ouvriers[i].releves = xmalloc( ouvriers[i].capacite_releves * sizeof(int) );
+	}
+	for( i=1; i<nb_threads; i++ ){
+		if( pthread_create( &ouvriers[i].thread, NULL, travailler_produit, &ouvriers[i] ) ){
+			perror( "pthread_create" );
+			exit( EXIT_FAILURE );
+		}
+	}
+
+	// Le thread principal participe au travail et prépare chaque niveau.
+	uint64_t * n_uplet_0 = xmalloc( nb_automates * sizeof(uint64_t) );
+	int * position_0 = xmalloc( nb_automates * sizeof(int) );
+	int * debut_0 = xmalloc( nb_automates * sizeof(int) );
+	int * fin_0 = xmalloc( nb_automates * sizeof(int) );
+	while( 1 ){
+		p.fini = p.taille_frontiere == 0;
+		atomic_store( &p.prochain_bloc, 0 );
+		attendre_barriere( p.barriere );
+		if( p.fini ) break;
+		while( 1 ){
+			size_t bloc = atomic_fetch_add( &p.prochain_bloc, 1 );
+			size_t premier = bloc * TAILLE_BLOC_PRODUIT;
+			if( premier >= p.taille_frontiere ) break;
+			size_t dernier = premier + TAILLE_BLOC_PRODUIT;
+			if( dernier > p.taille_frontiere ) dernier = p.taille_frontiere;
+			size_t j;
+			for( j=premier; j<dernier; j++ ){
+				traiter_n_uplet_produit( 
+					&ouvriers[0], p.frontiere + j * largeur, 
+					n_uplet_0, position_0, debut_0, fin_0 
+				);
+			}
+		}
+		attendre_barriere( p.barriere );
+
+		// Frontière suivante : concaténation des parts des threads.
+		size_t taille = 0;
+		for( i=0; i<nb_threads; i++ ) taille += ouvriers[i].taille_suivante;
+		if( taille > capacite_frontiere ){
+			capacite_frontiere = taille;
+			p.frontiere = xrealloc( p.frontiere, capacite_frontiere * sizeof(uint64_t) );
+		}
+		taille = 0;
+		for( i=0; i<nb_threads; i++ ){
+			memcpy( 
+				p.frontiere + taille, ouvriers[i].suivante, 
+				ouvriers[i].taille_suivante * sizeof(uint64_t) 
+			);
+			taille += ouvriers[i].taille_suivante;
+			ouvriers[i].taille_suivante = 0;
+		}
+		p.taille_frontiere = taille / largeur;
+	}
+	for( i=1; i<nb_threads; i++ ) pthread_join( ouvriers[i].thread, NULL );
+	xfree( n_uplet_0 );
+	xfree( position_0 );
+	xfree( debut_0 );
+	xfree( fin_0 );
+
+	// Numérotation compacte : les sous-tables sont mises bout à bout.
+	int nb_sous_tables = nb_sous_tables_vecteurs( p.n_uplets );
+	int decalage = 0;
+	while( ( 1 << decalage ) < nb_sous_tables ) decalage++;
+	int * debut_sous_table = xmalloc( ( nb_sous_tables + 1 ) * sizeof(int) );
+	debut_sous_table[0] = 0;
+	for( i=0; i<nb_sous_tables; i++ ){
+		debut_sous_table[i+1] = 
+			debut_sous_table[i] + taille_sous_table_vecteurs( p.n_uplets, i );
+	}
+	int nb_etats = debut_sous_table[nb_sous_tables];
+	#define COMPACT( id ) \
+		( debut_sous_table[ (id) & ( nb_sous_tables - 1 ) ] + ( (id) >> decalage ) )
+
+	// Où trouver les relevés de chaque n-uplet.
+	int * ouvrier_de = xmalloc( ( nb_etats + 1 ) * sizeof(int) );
+	size_t * releve_de = xmalloc( ( nb_etats + 1 ) * sizeof(size_t) );
+	for( i=0; i<nb_threads; i++ ){
+		size_t r = 0;
+		while( r < ouvriers[i].nb_releves ){
+			int etat = COMPACT( ouvriers[i].releves[r] );
+			ouvrier_de[etat] = i;
+			releve_de[etat] = r;
+			ouvriers[i].releves[r] = etat;
+			int nb_transitions = ouvriers[i].releves[r+2];
+			int t;
+			for( t=0; t<nb_transitions; t++ ){
+				int * fin_t = &ouvriers[i].releves[ r + 3 + 2*t + 1 ];
+				*fin_t = COMPACT( *fin_t );
+			}
+			r += 3 + 2 * nb_transitions;
+		}
+	}
+
+	// Renumérotation dans l'ordre de creer_produit_des_automates().
+	int * numero = xmalloc( ( nb_etats + 1 ) * sizeof(int) );
+	int * file = xmalloc( ( nb_etats + 1 ) * sizeof(int) );
+	int tete = 0, queue = 0, nb_numeros = 0;
+	for( i=0; i<nb_etats; i++ ) numero[i] = -1;
+	for( i=0; i<nb_initiaux; i++ ){
+		int etat = COMPACT( initiaux[i] );
+		if( numero[etat] < 0 ){
+			numero[etat] = nb_numeros++;
+			file[ queue++ ] = etat;
+		}
+		ajouter_etat_initial( res, numero[etat] );
+	}
+	#undef COMPACT
+	while( tete < queue ){
+		int etat = file[ tete++ ];
+		const int * releve = ouvriers[ ouvrier_de[etat] ].releves + releve_de[etat];
+		if( releve[1] ) ajouter_etat_final( res, numero[etat] );
+		int t;
+		for( t=0; t<releve[2]; t++ ){
+			int but = releve[ 3 + 2*t + 1 ];
+			if( numero[but] < 0 ){
+				numero[but] = nb_numeros++;
+				ajouter_etat( res, numero[but] );
+				file[ queue++ ] = but;
+			}
+			ajouter_transition( res, numero[etat], lettres[ releve[ 3 + 2*t ] ], numero[but] );
+		}
+	}
+
+	xfree( numero );
+	xfree( file );
+	xfree( ouvrier_de );
+	xfree( releve_de );
+	xfree( debut_sous_table );
+	for( i=0; i<nb_threads; i++ ){
+		xfree( ouvriers[i].suivante );
+		xfree( ouvriers[i].releves );
+	}
+	xfree( ouvriers );
+	xfree( initiaux );
+	xfree( p.frontiere );
+	xfree( indices );
+	liberer_barriere( p.barriere );
+	liberer_table_vecteurs_concurrente( p.n_uplets );
+	for( k=0; k<nb_automates; k++ ) liberer_graphe( p.graphes[k] );
+	xfree( p.graphes );
+	return res;
+}
+
+Automate * creer_intersection_des_automates_parallele(
+	const Automate * automate_1, const Automate * automate_2, int nb_threads
+){
+	const Automate * automates[2] = { emonder( automate_1 ), emonder( automate_2 ) };
+	Automate * res = creer_produit_des_automates_parallele( automates, 2, nb_threads );
+	liberer_automate( (Automate *) automates[0] );
+	liberer_automate( (Automate *) automates[1] );
+	return res;
+}
@@ -0,0 +1,92 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2014, 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file produit.h */ 
+
+#ifndef __PRODUIT_H__
+#define __PRODUIT_H__
+
+#include "automate.h"
+
+/**
+ * @brief Fonction appelée quand le produit atteint un nouvel état final.
+ *
+ * @param etat Le numéro de l'état dans le produit.
+ * @param etats Les états des automates composant cet état.
+ * @param nb_automates Le nombre d'automates.
+ * @param data La donnée passée à creer_produit_des_automates().
+ * @return Une valeur non nulle pour arrêter la construction.
+ */
+typedef int (* Arret_produit)(
+	int etat, const int * etats, int nb_automates, void * data
+);
+
+/**
+ * @brief Construit la partie accessible du produit de plusieurs automates.
+ *
+ * Les états du produit sont les n-uplets d'états accessibles depuis les 
+ * n-uplets d'états initiaux ; ils sont numérotés à partir de 0 dans l'ordre 
+ * d'un parcours en largeur. Un n-uplet est final si tous ses états le sont.
+ * Le produit a une transition par une lettre quand chaque automate en a une.
+ * Son alphabet est l'union des alphabets des automates.
+ *
+ * Si 'arret' n'est pas NULL, il est appelé à chaque nouvel état final ; s'il
+ * renvoie une valeur non nulle, la construction s'arrête et le produit 
+ * partiel est renvoyé.
+ *
+ * @param automates Les automates.
+ * @param nb_automates Le nombre d'automates (au moins 1).
+ * @param arret La fonction d'arrêt, ou NULL.
+ * @param data La donnée passée à la fonction d'arrêt.
+ * @param interrompu Si non NULL, reçoit 1 si la construction a été arrêtée.
+ * @return Le produit.
+ */
+Automate * creer_produit_des_automates(
+	const Automate * const * automates, int nb_automates,
+	Arret_produit arret, void * data, int * interrompu
+);
+
+/**
+ * @brief Construit la partie accessible du produit de plusieurs automates 
+ *        avec plusieurs threads.
+ *
+ * Le résultat est identique à celui de creer_produit_des_automates() sans 
+ * fonction d'arrêt, quels que soient le nombre de threads et leur 
+ * ordonnancement.
+ *
+ * @param automates Les automates.
+ * @param nb_automates Le nombre d'automates (au moins 1).
+ * @param nb_threads Le nombre de threads à utiliser (au moins 1).
+ * @return Le produit.
+ */
+Automate * creer_produit_des_automates_parallele(
+	const Automate * const * automates, int nb_automates, int nb_threads
+);
+
+/**
+ * @brief Crée l'intersection de deux automates avec plusieurs threads.
+ *
+ * Le résultat est identique à celui de creer_intersection_des_automates().
+ */
+Automate * creer_intersection_des_automates_parallele(
+	const Automate * automate_1, const Automate * automate_2, int nb_threads
+);
+
+#endif
@@ -24,11 +24,15 @@
 #include "parse.h"
 #include "scan.h"
 #include "outils.h"
+#include "simulation.h"
+#include "inclusion.h"
+#include "equivalence.h"
 
 #include <stdbool.h>
 #include <stdlib.h>
 #include <assert.h>
 #include <stdio.h>
+#include <string.h>
 
 int yyparse(Rationnel **rationnel, yyscan_t scanner);
 
@@ -701,9 +705,13 @@ Automate *Glushkov(Rationnel *rat) {
 }
 
 /* La fonction devrait etre dans automate.c mais automate.h ne peut pas etre modifié */
-Automate *automate_complementaire(const Automate *automate) {
+Statut_budget automate_complementaire_budget(const Automate *automate, Budget *budget, Automate **resultat) {
    // creer_automate_deterministe() fait aussi la complétion
-   Automate *a = creer_automate_deterministe(automate);
+   Automate *a;
+   Statut_budget statut = creer_automate_deterministe_budget(automate, budget, &a);
+   *resultat = a;
+   if(statut != BUDGET_RESPECTE)
+      return statut;
 
    const Ensemble *etats = get_etats(a);
 
@@ -723,19 +731,119 @@ Automate *automate_complementaire(const Automate *automate) {
    liberer_ensemble(a->finaux);
    a->finaux = nouveaux_finaux;
 
+   return BUDGET_RESPECTE;
+}
+
+Automate *automate_complementaire(const Automate *automate) {
+   Automate *a;
+   automate_complementaire_budget(automate, NULL, &a);
    return a;
 }
 
-bool meme_langage_rat (Rationnel *r1, Rationnel *r2)
+void signature_rationnel(Rationnel *rat, Signature_rationnel *signature)
+{
+   memset(signature, 0, sizeof(Signature_rationnel));
+   if(!rat) {
+      signature->vide = true;
+      signature->longueur_min = -1;
+      signature->longueur_max = 0;
+      return;
+   }
+
+   Signature_rationnel g, d;
+   int i;
+   switch(rat->etiquette) {
+      case EPSILON:
+         signature->mot_vide = true;
+         break;
+      case LETTRE:
+         METTRE_BIT(signature->alphabet, (unsigned char) rat->lettre);
+         METTRE_BIT(signature->premieres, (unsigned char) rat->lettre);
+         METTRE_BIT(signature->dernieres, (unsigned char) rat->lettre);
+         signature->longueur_min = 1;
+         signature->longueur_max = 1;
+         break;
+      case STAR:
+         signature_rationnel(rat->gauche, &g);
+         *signature = g;
+         signature->mot_vide = true;
+         signature->longueur_min = 0;
+         signature->longueur_max = g.longueur_max == 0 ? 0 : -1;
+         break;
+      case UNION:
+         signature_rationnel(rat->gauche, &g);
+         signature_rationnel(rat->droit, &d);
+         signature->mot_vide = g.mot_vide || d.mot_vide;
+         for(i=0; i<4; i++) {
+            signature->alphabet[i] = g.alphabet[i] | d.alphabet[i];
+            signature->premieres[i] = g.premieres[i] | d.premieres[i];
+            signature->dernieres[i] = g.dernieres[i] | d.dernieres[i];
+         }
+         signature->longueur_min = g.longueur_min < d.longueur_min ? g.longueur_min : d.longueur_min;
+         if(g.longueur_max < 0 || d.longueur_max < 0)
+            signature->longueur_max = -1;
+         else
+            signature->longueur_max = g.longueur_max > d.longueur_max ? g.longueur_max : d.longueur_max;
+         break;
+      case CONCAT:
+         signature_rationnel(rat->gauche, &g);
+         signature_rationnel(rat->droit, &d);
+         signature->mot_vide = g.mot_vide && d.mot_vide;
+         for(i=0; i<4; i++) {
+            signature->alphabet[i] = g.alphabet[i] | d.alphabet[i];
+            signature->premieres[i] = g.premieres[i] | (g.mot_vide ? d.premieres[i] : 0);
+            signature->dernieres[i] = d.dernieres[i] | (d.mot_vide ? g.dernieres[i] : 0);
+         }
+         signature->longueur_min = g.longueur_min + d.longueur_min;
+         if(g.longueur_max < 0 || d.longueur_max < 0)
+            signature->longueur_max = -1;
+         else
+            signature->longueur_max = g.longueur_max + d.longueur_max;
+         break;
+   }
+}
+
+bool signatures_differentes(const Signature_rationnel *s1, const Signature_rationnel *s2)
+{
+   if(s1->vide != s2->vide || s1->mot_vide != s2->mot_vide)
+      return true;
+   if(s1->longueur_min != s2->longueur_min || s1->longueur_max != s2->longueur_max)
+      return true;
+   for(int i=0; i<4; i++)
+      if(s1->alphabet[i] != s2->alphabet[i] || s1->premieres[i] != s2->premieres[i] || s1->dernieres[i] != s2->dernieres[i])
+         return true;
+   return false;
+}
+
+Statut_budget meme_langage_rat_budget (Rationnel *r1, Rationnel *r2, int options, Budget *budget, bool *resultat)
 {
+   *resultat = false;
+
+   // invariants calculés sur les arbres : la plupart des expressions de 
+   // langages différents sont séparées sans construire d'automate
+   Signature_rationnel s1, s2;
+   signature_rationnel(r1, &s1);
+   signature_rationnel(r2, &s2);
+   if(signatures_differentes(&s1, &s2))
+      return BUDGET_RESPECTE;
+
    // a1 et a2 respectivement automates représentant les expression rationnelles expr1 et expr2
    Automate *a1 = Glushkov(r1);
    Automate *a2 = Glushkov(r2);
 
+   if(options & OPTION_REDUCTION_SIMULATION) {
+      Automate *reduit = reduire_par_simulation(a1);
+      liberer_automate(a1);
+      a1 = reduit;
+      reduit = reduire_par_simulation(a2);
+      liberer_automate(a2);
+      a2 = reduit;
+   }
+
    if(comparer_ensemble(get_alphabet(a1), get_alphabet(a2)) != 0) {
       liberer_automate(a1);
       liberer_automate(a2);
-      return false;
+      return BUDGET_RESPECTE;
    }
 
    printf("A1 :\n");
@@ -746,67 +854,111 @@ bool meme_langage_rat (Rationnel *r1, Rationnel *r2)
    print_automate(a2);
    printf("\n");
 
-   // a2c l'automate complémentaire de a2
-   Automate *a2c = automate_complementaire(a2);
-
-   printf("A2c :\n");
-   print_automate(a2c);
-   printf("\n");
+   // deux tests d'inclusion par antichaînes : aucun des deux automates 
+   // n'est déterminisé, et chaque test s'arrête au premier contre-exemple
+   bool inclus = false;
+   Statut_budget statut = est_inclus_budget(a1, a2, budget, &inclus);
+   if(statut == BUDGET_RESPECTE && inclus)
+      statut = est_inclus_budget(a2, a1, budget, &inclus);
 
+   liberer_automate(a1);
    liberer_automate(a2);
 
-   // a l'intersection de a1 et a2c
-   Automate *a = creer_intersection_des_automates(a1, a2c);
-
-   printf("A :\n");
-   print_automate(a);
-   printf("\n");
-
-   liberer_automate(a1);
-   liberer_automate(a2c);
+   if(statut == BUDGET_RESPECTE)
+      *resultat = inclus;
+   return statut;
+}
 
-   // on cherche a voir si aucun état final n'est accessible depuis un état initial
+bool meme_langage_rat_avec_options (Rationnel *r1, Rationnel *r2, int options)
+{
+   bool res;
+   meme_langage_rat_budget(r1, r2, options, NULL, &res);
+   return res;
+}
 
-   Ensemble_iterateur it = premier_iterateur_ensemble(get_initiaux(a));
+bool meme_langage_rat (Rationnel *r1, Rationnel *r2)
+{
+   return meme_langage_rat_avec_options(r1, r2, 0);
+}
 
-   while(!iterateur_ensemble_est_vide(it)) {
-      int elt = (int)get_element(it);
+bool meme_langage_avec_options (const char *expr1, const char* expr2, int options) {
+   Rationnel *r1 = expression_to_rationnel(expr1);
+   Rationnel *r2 = expression_to_rationnel(expr2);
 
-      Ensemble *accessibles = etats_accessibles(a, elt);
+   bool res = meme_langage_rat_avec_options(r1, r2, options);
 
-      Ensemble_iterateur it2 = premier_iterateur_ensemble(accessibles);
+   liberer_rationnel(r1);
+   liberer_rationnel(r2);
 
-      while(!iterateur_ensemble_est_vide(it2)) {
-         if(est_un_etat_final_de_l_automate(a, (int)get_element(it2))) {
-            liberer_ensemble(accessibles);
-            liberer_automate(a);
-            return false;
-         }
+   return res;
+}
 
-         it2 = iterateur_suivant_ensemble(it2);
-      }
+bool meme_langage (const char *expr1, const char* expr2) {
+   return meme_langage_avec_options(expr1, expr2, 0);
+}
 
-      liberer_ensemble(accessibles);
+bool meme_langage_temoin (const char *expr1, const char* expr2, char **mot) {
+   Rationnel *r1 = expression_to_rationnel(expr1);
+   Rationnel *r2 = expression_to_rationnel(expr2);
+   Automate *a1 = Glushkov(r1);
+   Automate *a2 = Glushkov(r2);
 
-      it = iterateur_suivant_ensemble(it);
+   // un plus court mot distinguant est le plus court des contre-exemples 
+   // aux deux inclusions
+   char *mot1, *mot2;
+   bool res = est_inclus_temoin(a1, a2, &mot1);
+   res = est_inclus_temoin(a2, a1, &mot2) && res;
+   if(mot1 && mot2 && strlen(mot2) < strlen(mot1)) {
+      xfree(mot1);
+      mot1 = mot2;
+      mot2 = NULL;
    }
+   if(!mot1) {
+      mot1 = mot2;
+      mot2 = NULL;
+   }
+   xfree(mot2);
+   if(mot)
+      *mot = mot1;
+   else
+      xfree(mot1);
 
-   liberer_automate(a);
-   return true;
+   liberer_automate(a1);
+   liberer_automate(a2);
+   liberer_rationnel(r1);
+   liberer_rationnel(r2);
+
+   return res;
 }
 
-bool meme_langage (const char *expr1, const char* expr2) {
+bool expressions_equivalentes (const char *expr1, const char* expr2, char **mot) {
    Rationnel *r1 = expression_to_rationnel(expr1);
    Rationnel *r2 = expression_to_rationnel(expr2);
+   Automate *a1 = Glushkov(r1);
+   Automate *a2 = Glushkov(r2);
 
-   bool res = meme_langage_rat(r1, r2);
+   bool res = equivalent(a1, a2, mot);
 
+   liberer_automate(a1);
+   liberer_automate(a2);
    liberer_rationnel(r1);
    liberer_rationnel(r2);
 
    return res;
 }
 
+Statut_budget meme_langage_budget (const char *expr1, const char* expr2, Budget *budget, bool *resultat) {
+   Rationnel *r1 = expression_to_rationnel(expr1);
+   Rationnel *r2 = expression_to_rationnel(expr2);
+
+   Statut_budget statut = meme_langage_rat_budget(r1, r2, 0, budget, resultat);
+
+   liberer_rationnel(r1);
+   liberer_rationnel(r2);
+
+   return statut;
+}
+
 void systeme_ajouter_transition(int origine, char lettre, int fin, void *data) {
    Systeme systeme = (Systeme)data;
 
@@ -878,11 +1030,10 @@ Rationnel **resoudre_variable_arden(Rationnel **ligne, int numero_variable, int
       Rationnel *star = Star(ligne[numero_variable]);
       ligne[numero_variable] = NULL;
 
+      // U*.∅ = ∅ : un terme absent, y compris le terme constant, le reste
       for(int i=0; i<n; i++)
          if(ligne[i])
             ligne[i] = Concat(copier_rationnel(star), ligne[i]);
-         else if(i == n-1)
-            ligne[i] = copier_rationnel(star);
 
 
       liberer_rationnel(star);
@@ -918,48 +1069,95 @@ Rationnel **substituer_variable(Rationnel **ligne, int numero_variable, Rationne
    return ligne;
 }
 
-Systeme resoudre_systeme(Systeme systeme, int n)
+int taille_rationnel(Rationnel *rat)
 {
+   if(!rat)
+      return 0;
+   return 1 + taille_rationnel(rat->gauche) + taille_rationnel(rat->droit);
+}
+
+/*
+ * Met à jour le nombre de noeuds de la ligne i du système, puis vérifie le 
+ * budget ; la mémoire comptée est celle des expressions du système.
+ */
+Statut_budget verifier_budget_systeme(Systeme systeme, int n, int i, long *taille_ligne, long *taille_totale, Budget *budget)
+{
+   if(!budget)
+      return BUDGET_RESPECTE;
+
+   long taille = 0;
+   for(int j=0; j<=n; j++)
+      taille += taille_rationnel(systeme[i][j]);
+   *taille_totale += taille - taille_ligne[i];
+   taille_ligne[i] = taille;
+
+   return verifier_budget(budget, n, *taille_totale * sizeof(Rationnel));
+}
+
+Statut_budget resoudre_systeme_budget(Systeme systeme, int n, Budget *budget)
+{
+   Statut_budget statut = BUDGET_RESPECTE;
+   long *taille_ligne = calloc(n+1, sizeof(long));
+   long taille_totale = 0;
+
+   for(int i=0; i<n && statut == BUDGET_RESPECTE; i++)
+      statut = verifier_budget_systeme(systeme, n, i, taille_ligne, &taille_totale, budget);
+
    printf("Initialisation : \n");
    print_systeme(systeme, n);
 
-   for(int i=n-1; i>=0; i--) {
+   for(int i=n-1; i>=0 && statut == BUDGET_RESPECTE; i--) {
       systeme[i] = resoudre_variable_arden(systeme[i], i, n+1);
+      statut = verifier_budget_systeme(systeme, n, i, taille_ligne, &taille_totale, budget);
 
       printf("Arden sur %d : \n", i);
       print_systeme(systeme, n);
 
-      for(int j=0; j<i; j++) {
+      for(int j=0; j<i && statut == BUDGET_RESPECTE; j++) {
          substituer_variable(systeme[j], i, systeme[i], n+1);
+         statut = verifier_budget_systeme(systeme, n, j, taille_ligne, &taille_totale, budget);
 
          printf("Substitution de %d dans %d: \n", i, j);
          print_systeme(systeme, n);
       }
    }
 
-   for(int i=0; i<n-1; i++) {
-      for(int j=i+1; j<n; j++) {
+   for(int i=0; i<n-1 && statut == BUDGET_RESPECTE; i++) {
+      for(int j=i+1; j<n && statut == BUDGET_RESPECTE; j++) {
          substituer_variable(systeme[j], i, systeme[i], n+1);
+         statut = verifier_budget_systeme(systeme, n, j, taille_ligne, &taille_totale, budget);
 
          printf("Substitution de %d dans %d: \n", i, j);
          print_systeme(systeme, n);
       }
    }
 
+   free(taille_ligne);
+   return statut;
+}
+
+Systeme resoudre_systeme(Systeme systeme, int n)
+{
+   resoudre_systeme_budget(systeme, n, NULL);
    return systeme;
 }
 
-Rationnel *Arden(Automate *automate_bis)
+Statut_budget Arden_budget(Automate *automate_bis, Budget *budget, Rationnel **resultat)
 {
    Rationnel* expr = NULL;
-   Automate *automate = creer_automate_minimal(automate_bis);
+   *resultat = NULL;
+   Automate *automate;
+   Statut_budget statut = creer_automate_minimal_budget(automate_bis, budget, &automate);
+   if(statut != BUDGET_RESPECTE)
+      return statut;
+
    Systeme sys = systeme(automate);
    unsigned int taille_automate = taille_ensemble(get_etats(automate));
-   sys = resoudre_systeme(sys, taille_automate);
+   statut = resoudre_systeme_budget(sys, taille_automate, budget);
 
    Ensemble_iterateur it = premier_iterateur_ensemble(get_initiaux(automate));
 
-   while(!iterateur_ensemble_est_vide(it)) {
+   while(statut == BUDGET_RESPECTE && !iterateur_ensemble_est_vide(it)) {
       int initial = (int)get_element(it);
 
       if(expr)
@@ -973,6 +1171,13 @@ Rationnel *Arden(Automate *automate_bis)
    liberer_automate(automate);
    liberer_systeme(sys, taille_automate);
 
-   return expr;
+   *resultat = expr;
+   return statut;
 }
 
+Rationnel *Arden(Automate *automate_bis)
+{
+   Rationnel *expr;
+   Arden_budget(automate_bis, NULL, &expr);
+   return expr;
+}
@@ -23,6 +23,7 @@
 #ifndef __RATIONNEL_H__
 #define __RATIONNEL_H__
 #include <stdbool.h>
+#include <stdint.h>
 #include <stdio.h>
 #include "automate.h"
 #include "ensemble.h"
@@ -320,16 +321,108 @@ Ensemble *suivant(Rationnel *, int);
  */
 Automate *Glushkov(Rationnel *rat);
 
+/**
+ * @brief Invariants d'un langage, calculables sur l'arbre d'une expression 
+ * en temps linéaire.
+ *
+ * Comme l'ensemble vide n'apparaît qu'à la racine (NULL), chaque 
+ * sous-expression dénote un langage non vide : ces invariants sont exacts 
+ * et deux expressions dont les signatures diffèrent ne reconnaissent pas le
+ * même langage.
+ */
+typedef struct Signature_rationnel {
+   bool vide;                 //!< Le langage est vide.
+   bool mot_vide;             //!< Le langage contient le mot vide.
+   uint64_t alphabet[4];      //!< Lettres apparaissant dans un mot (unsigned char).
+   uint64_t premieres[4];     //!< Lettres pouvant commencer un mot.
+   uint64_t dernieres[4];     //!< Lettres pouvant finir un mot.
+   int longueur_min;          //!< Longueur du plus court mot.
+   int longueur_max;          //!< Longueur du plus long mot, -1 si le langage est infini.
+} Signature_rationnel;
+
+/**
+ * @brief Calcule la signature d'une expression.
+ * @param rat L'expression, ou NULL pour le langage vide.
+ * @param signature Reçoit la signature.
+ */
+void signature_rationnel(Rationnel *rat, Signature_rationnel *signature);
+
+/**
+ * @brief Compare deux signatures.
+ * @return true si les signatures diffèrent, et donc les langages aussi.
+ */
+bool signatures_differentes(const Signature_rationnel *s1, const Signature_rationnel *s2);
+
 /**
  * @brief @todo
  * Teste si deux expressions reconnaissent le même langage.
  *
+ * Les signatures des deux expressions (voir @ref Signature_rationnel) sont 
+ * comparées avant de construire le moindre automate.
+ *
  * @param expr1 La première expression.
  * @param expr2 La deuxième expression.
  * @result true ou false.
  */
 bool meme_langage (const char *expr1, const char* expr2);
 
+/**
+ * @brief Teste si deux expressions reconnaissent le même langage, en donnant
+ * un plus court mot qui les distingue.
+ *
+ * Les deux inclusions sont testées par antichaînes (voir inclusion.h) et le 
+ * plus court des deux contre-exemples est renvoyé.
+ *
+ * @param expr1 La première expression.
+ * @param expr2 La deuxième expression.
+ * @param mot Si non NULL, reçoit NULL si les expressions reconnaissent le 
+ * même langage, et sinon un plus court mot du langage d'une seule des deux, à
+ * libérer avec xfree().
+ * @result true ou false.
+ */
+bool meme_langage_temoin (const char *expr1, const char* expr2, char **mot);
+
+/**
+ * @brief Teste si deux expressions reconnaissent le même langage avec 
+ * l'algorithme de Hopcroft et Karp (voir equivalence.h), appliqué aux 
+ * automates de Glushkov déterminisés à la volée.
+ *
+ * Contrairement à meme_langage(), les langages sont comparés sur l'union des
+ * alphabets des deux expressions.
+ *
+ * @param expr1 La première expression.
+ * @param expr2 La deuxième expression.
+ * @param mot Si non NULL, reçoit NULL si les expressions sont équivalentes, 
+ * et sinon un plus court mot du langage d'une seule des deux, à libérer avec
+ * xfree().
+ * @result true ou false.
+ */
+bool expressions_equivalentes (const char *expr1, const char* expr2, char **mot);
+
+/**
+ * @brief Teste si deux expressions reconnaissent le même langage, en 
+ * appliquant éventuellement des traitements préalables aux automates de 
+ * Glushkov (voir les constantes OPTION_* de automate.h).
+ *
+ * @param expr1 La première expression.
+ * @param expr2 La deuxième expression.
+ * @param options Une combinaison (ou bit à bit) des constantes OPTION_*.
+ * @result true ou false.
+ */
+bool meme_langage_avec_options (const char *expr1, const char* expr2, int options);
+
+/**
+ * @brief Teste si deux expressions reconnaissent le même langage, sans 
+ * dépasser un budget (voir budget.h).
+ *
+ * @param expr1 La première expression.
+ * @param expr2 La deuxième expression.
+ * @param budget Le budget, ou NULL.
+ * @param resultat Reçoit true ou false si le budget est respecté.
+ * @return BUDGET_RESPECTE, ou la raison de l'abandon.
+ */
+Statut_budget meme_langage_budget (const char *expr1, const char* expr2, Budget *budget, bool *resultat);
+
 /**
  * @brief @todo Construit le système d'équations de langages associé à un automate. Voir @ref Systeme pour la représentation de ce système.
  * @param automate L'automate à transformer en système, en supposant ses états
@@ -389,4 +482,18 @@ Systeme resoudre_systeme(Systeme sys, int nb_vars);
  */
 Rationnel *Arden(Automate *automate);
 
+/**
+ * @brief Convertit un automate en expression rationnelle, sans dépasser un 
+ * budget (voir budget.h).
+ *
+ * Le nombre d'états compté est celui de l'automate minimal ; la mémoire 
+ * comptée est celle des expressions du système d'équations.
+ *
+ * @param automate L'automate d'entrée.
+ * @param budget Le budget, ou NULL.
+ * @param resultat Reçoit l'expression, ou NULL en cas d'abandon.
+ * @return BUDGET_RESPECTE, ou la raison de l'abandon.
+ */
+Statut_budget Arden_budget(Automate *automate, Budget *budget, Rationnel **resultat);
+
 #endif
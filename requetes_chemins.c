@@ -0,0 +1,302 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2014, 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "requetes_chemins.h"
+#include "graphe.h"
+#include "outils.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+Graphe_etiquete * creer_graphe_etiquete(
+	int nb_noeuds, int nb_aretes, 
+	const int * origines, const char * lettres, const int * cibles
+){
+	Graphe_etiquete * graphe = xmalloc( sizeof(Graphe_etiquete) );
+	graphe->nb_noeuds = nb_noeuds;
+	graphe->nb_aretes = nb_aretes;
+	graphe->debut = xmalloc( ( nb_noeuds + 1 ) * sizeof(int) );
+	graphe->lettres = xmalloc( nb_aretes + 1 );
+	graphe->cibles = xmalloc( ( nb_aretes + 1 ) * sizeof(int) );
+
+	// Tri des arêtes par origine, par dénombrement.
+	memset( graphe->debut, 0, ( nb_noeuds + 1 ) * sizeof(int) );
+	int i;
+	for( i=0; i<nb_aretes; i++ ){
+		assert( 0 <= origines[i] && origines[i] < nb_noeuds );
+		assert( 0 <= cibles[i] && cibles[i] < nb_noeuds );
+		graphe->debut[ origines[i] + 1 ]++;
+	}
+	for( i=0; i<nb_noeuds; i++ ) graphe->debut[i+1] += graphe->debut[i];
+	int * place = xmalloc( ( nb_noeuds + 1 ) * sizeof(int) );
+	memcpy( place, graphe->debut, ( nb_noeuds + 1 ) * sizeof(int) );
+	for( i=0; i<nb_aretes; i++ ){
+		int k = place[ origines[i] ]++;
+		graphe->lettres[k] = lettres[i];
+		graphe->cibles[k] = cibles[i];
+	}
+	xfree( place );
+	return graphe;
+}
+
+void liberer_graphe_etiquete( Graphe_etiquete * graphe ){
+	xfree( graphe->debut );
+	xfree( graphe->lettres );
+	xfree( graphe->cibles );
+	xfree( graphe );
+}
+
+/**
+ * @brief Table creuse de mots de 64 bits, indexée par des clés entières.
+ *
+ * Seules les clés rencontrées occupent de la mémoire, et la table se vide en 
+ * temps proportionnel au nombre de ses entrées : sa capacité est conservée 
+ * d'un lot à l'autre.
+ */
+typedef struct {
+	int largeur;                //!< Nombre de mots par entrée.
+	int nb_entrees;
+	int capacite;
+	size_t * cles;
+	size_t * places;            //!< Alvéole de chaque entrée.
+	uint64_t * valeurs;         //!< Mot j de l'entrée i en valeurs[i*largeur+j].
+	int * alveoles;             //!< Numéro d'entrée, ou -1 pour une alvéole vide.
+	size_t nb_alveoles;         //!< Toujours une puissance de 2.
+} Table_creuse_requete;
+
+void initialiser_table_creuse_requete( Table_creuse_requete * t, int largeur ){
+	t->largeur = largeur;
+	t->nb_entrees = 0;
+	t->capacite = 16;
+	t->cles = xmalloc( t->capacite * sizeof(size_t) );
+	t->places = xmalloc( t->capacite * sizeof(size_t) );
+	t->valeurs = xmalloc( t->capacite * largeur * sizeof(uint64_t) );
+	t->nb_alveoles = 32;
+	t->alveoles = xmalloc( t->nb_alveoles * sizeof(int) );
+	memset( t->alveoles, -1, t->nb_alveoles * sizeof(int) );
+}
+
+void liberer_table_creuse_requete( Table_creuse_requete * t ){
+	xfree( t->cles );
+	xfree( t->places );
+	xfree( t->valeurs );
+	xfree( t->alveoles );
+}
+
+void vider_table_creuse_requete( Table_creuse_requete * t ){
+	int i;
+	for( i=0; i<t->nb_entrees; i++ ) t->alveoles[ t->places[i] ] = -1;
+	t->nb_entrees = 0;
+}
+
+size_t alveole_cle_requete( const Table_creuse_requete * t, size_t cle ){
+	uint64_t h = (uint64_t) cle * 0x9E3779B97F4A7C15ULL;
+	h ^= h >> 29;
+	size_t masque = t->nb_alveoles - 1;
+	size_t a = (size_t) h & masque;
+	while( t->alveoles[a] >= 0 && t->cles[ t->alveoles[a] ] != cle ){
+		a = ( a + 1 ) & masque;
+	}
+	return a;
+}
+
+void agrandir_alveoles_requete( Table_creuse_requete * t ){
+	xfree( t->alveoles );
+	t->nb_alveoles *= 2;
+	t->alveoles = xmalloc( t->nb_alveoles * sizeof(int) );
+	memset( t->alveoles, -1, t->nb_alveoles * sizeof(int) );
+	int i;
+	for( i=0; i<t->nb_entrees; i++ ){
+		size_t a = alveole_cle_requete( t, t->cles[i] );
+		t->alveoles[a] = i;
+		t->places[i] = a;
+	}
+}
+
+/**
+ * @brief Renvoie le numéro de l'entrée d'une clé, en la créant (avec des mots
+ * nuls) si besoin.
+ */
+int entree_table_creuse_requete( Table_creuse_requete * t, size_t cle ){
+	size_t a = alveole_cle_requete( t, cle );
+	if( t->alveoles[a] >= 0 ) return t->alveoles[a];
+
+	if( t->nb_entrees == t->capacite ){
+		t->capacite *= 2;
+		t->cles = xrealloc( t->cles, t->capacite * sizeof(size_t) );
+		t->places = xrealloc( t->places, t->capacite * sizeof(size_t) );
+		t->valeurs = xrealloc( 
+			t->valeurs, t->capacite * t->largeur * sizeof(uint64_t) 
+		);
+	}
+	int i = t->nb_entrees++;
+	t->cles[i] = cle;
+	t->places[i] = a;
+	memset( &t->valeurs[ (size_t) i * t->largeur ], 0, t->largeur * sizeof(uint64_t) );
+	t->alveoles[a] = i;
+
+	// Taux de remplissage maximal : 1/2.
+	if( 2 * (size_t) t->nb_entrees > t->nb_alveoles ){
+		agrandir_alveoles_requete( t );
+	}
+	return i;
+}
+
+/**
+ * @brief État du parcours du produit pour un lot d'au plus 64 sources.
+ */
+typedef struct {
+	const Graphe_etiquete * graphe;
+	const Graphe * requete;
+	const int * sources;        //!< Les sources du lot : le bit i désigne sources[i].
+	Table_creuse_requete couples; //!< Par couple (noeud, état) atteint : sources qui l'atteignent, puis sources pas encore propagées.
+	Table_creuse_requete signales; //!< Par noeud : sources déjà signalées.
+	int * file;                 //!< File circulaire des entrées de 'couples' à propager.
+	size_t capacite_file;
+	size_t tete;
+	size_t nb_en_file;
+	void (* action)( int source, int noeud, void * data );
+	void * data;
+} Parcours_requete;
+
+void enfiler_couple_requete( Parcours_requete * p, int entree ){
+	if( p->nb_en_file == p->capacite_file ){
+		int * file = xmalloc( 2 * p->capacite_file * sizeof(int) );
+		size_t i;
+		for( i=0; i<p->nb_en_file; i++ ){
+			file[i] = p->file[ ( p->tete + i ) % p->capacite_file ];
+		}
+		xfree( p->file );
+		p->file = file;
+		p->capacite_file *= 2;
+		p->tete = 0;
+	}
+	p->file[ ( p->tete + p->nb_en_file++ ) % p->capacite_file ] = entree;
+}
+
+/**
+ * @brief Ajoute des sources à un couple (noeud, état) du produit.
+ */
+void atteindre_couple_requete( 
+	Parcours_requete * p, int noeud, int etat, uint64_t sources 
+){
+	size_t couple = (size_t) noeud * p->requete->nb_etats + etat;
+	int entree = entree_table_creuse_requete( &p->couples, couple );
+	uint64_t * valeurs = &p->couples.valeurs[ 2 * (size_t) entree ];
+	uint64_t nouvelles = sources & ~valeurs[0];
+	if( ! nouvelles ) return;
+	valeurs[0] |= nouvelles;
+	if( ! valeurs[1] ) enfiler_couple_requete( p, entree );
+	valeurs[1] |= nouvelles;
+
+	if( p->requete->final[etat] ){
+		int i = entree_table_creuse_requete( &p->signales, noeud );
+		uint64_t a_signaler = nouvelles & ~p->signales.valeurs[i];
+		p->signales.valeurs[i] |= a_signaler;
+		while( a_signaler ){
+			int bit = __builtin_ctzll( a_signaler );
+			a_signaler &= a_signaler - 1;
+			p->action( p->sources[bit], noeud, p->data );
+		}
+	}
+}
+
+void parcourir_lot_requete( Parcours_requete * p, int nb_sources ){
+	const Graphe_etiquete * graphe = p->graphe;
+	const Graphe * requete = p->requete;
+	int k = requete->nb_etats;
+	int nb_lettres = requete->nb_lettres;
+	// Seules les entrées du lot précédent sont effacées.
+	vider_table_creuse_requete( &p->couples );
+	vider_table_creuse_requete( &p->signales );
+	p->tete = 0;
+	p->nb_en_file = 0;
+
+	int i, j, a, t;
+	for( i=0; i<nb_sources; i++ ){
+		for( j=0; j<requete->nb_initiaux; j++ ){
+			atteindre_couple_requete( 
+				p, p->sources[i], requete->initiaux[j], (uint64_t) 1 << i 
+			);
+		}
+	}
+
+	while( p->nb_en_file > 0 ){
+		int entree = p->file[ p->tete ];
+		p->tete = ( p->tete + 1 ) % p->capacite_file;
+		p->nb_en_file--;
+		uint64_t sources = p->couples.valeurs[ 2 * (size_t) entree + 1 ];
+		p->couples.valeurs[ 2 * (size_t) entree + 1 ] = 0;
+		size_t couple = p->couples.cles[entree];
+		int noeud = couple / k;
+		int etat = couple % k;
+		for( a=graphe->debut[noeud]; a<graphe->debut[noeud+1]; a++ ){
+			int lettre = requete->indice_lettre[ (unsigned char) graphe->lettres[a] ];
+			if( lettre < 0 ) continue;
+			int cellule = etat * nb_lettres + lettre;
+			for( t=requete->debut[cellule]; t<requete->debut[cellule+1]; t++ ){
+				atteindre_couple_requete( 
+					p, graphe->cibles[a], requete->fins[t], sources 
+				);
+			}
+		}
+	}
+}
+
+void requete_chemins(
+	const Graphe_etiquete * graphe, const Automate * requete,
+	const int * sources, int nb_sources,
+	void (* action)( int source, int noeud, void * data ), void * data
+){
+	Graphe * automate = creer_graphe( requete );
+	int * tous = NULL;
+	if( ! sources ){
+		int i;
+		nb_sources = graphe->nb_noeuds;
+		tous = xmalloc( ( nb_sources + 1 ) * sizeof(int) );
+		for( i=0; i<nb_sources; i++ ) tous[i] = i;
+		sources = tous;
+	}
+
+	Parcours_requete p;
+	p.graphe = graphe;
+	p.requete = automate;
+	initialiser_table_creuse_requete( &p.couples, 2 );
+	initialiser_table_creuse_requete( &p.signales, 1 );
+	p.capacite_file = 16;
+	p.file = xmalloc( p.capacite_file * sizeof(int) );
+	p.action = action;
+	p.data = data;
+
+	int debut;
+	for( debut=0; debut<nb_sources; debut+=64 ){
+		p.sources = sources + debut;
+		parcourir_lot_requete( 
+			&p, nb_sources - debut < 64 ? nb_sources - debut : 64 
+		);
+	}
+
+	liberer_table_creuse_requete( &p.couples );
+	liberer_table_creuse_requete( &p.signales );
+	xfree( p.file );
+	xfree( tous );
+	liberer_graphe( automate );
+}
@@ -0,0 +1,101 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2014, 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file requetes_chemins.h */ 
+
+#ifndef __REQUETES_CHEMINS_H__
+#define __REQUETES_CHEMINS_H__
+
+#include "automate.h"
+
+/**
+ * @brief Graphe orienté dont les arêtes sont étiquetées par des lettres, 
+ * stocké en lignes compressées.
+ *
+ * Les noeuds sont numérotés de 0 à nb_noeuds-1. Les arêtes issues du noeud 
+ * v sont les indices k de debut[v] à debut[v+1]-1 : elles mènent au noeud 
+ * cibles[k] et sont étiquetées par lettres[k].
+ */
+typedef struct Graphe_etiquete {
+	int nb_noeuds;
+	int nb_aretes;
+	int * debut;                //!< Taille nb_noeuds+1.
+	char * lettres;
+	int * cibles;
+} Graphe_etiquete;
+
+/**
+ * @brief Construit un graphe étiqueté à partir de la liste de ses arêtes, en
+ * temps linéaire.
+ *
+ * @param nb_noeuds Le nombre de noeuds.
+ * @param nb_aretes Le nombre d'arêtes.
+ * @param origines Les origines des arêtes, entre 0 et nb_noeuds-1.
+ * @param lettres Les étiquettes des arêtes.
+ * @param cibles Les cibles des arêtes, entre 0 et nb_noeuds-1.
+ * @return Le graphe, indépendant des tableaux donnés du point de vue de la 
+ *         mémoire.
+ */
+Graphe_etiquete * creer_graphe_etiquete(
+	int nb_noeuds, int nb_aretes, 
+	const int * origines, const char * lettres, const int * cibles
+);
+
+/**
+ * @brief Détruit un graphe étiqueté.
+ *
+ * @param graphe Le graphe à détruire.
+ */
+void liberer_graphe_etiquete( Graphe_etiquete * graphe );
+
+/**
+ * @brief Évalue une requête de chemins réguliers : trouve les couples 
+ * (source, noeud) reliés par un chemin dont l'étiquette est reconnue par un
+ * automate.
+ *
+ * Le produit du graphe et de l'automate est parcouru à la volée, sans être 
+ * construit. Les sources sont traitées par lots de 64 : chaque couple 
+ * (noeud, état de l'automate) porte un mot de 64 bits qui indique les 
+ * sources du lot qui l'atteignent, et un seul parcours suffit pour tout le 
+ * lot. Seuls les couples atteints par le lot occupent de la mémoire (une 
+ * cinquantaine d'octets chacun), et seuls eux sont effacés avant le lot 
+ * suivant : le coût d'un lot ne dépend pas de la taille du graphe, mais de 
+ * la partie du produit qu'il atteint.
+ *
+ * Chaque couple est signalé une seule fois. Un noeud est relié à lui-même si
+ * l'automate reconnaît le mot vide.
+ *
+ * @param graphe Un graphe étiqueté.
+ * @param requete Un automate, déterministe ou non (par exemple obtenu par 
+ *        Glushkov() à partir d'une expression rationnelle).
+ * @param sources Les noeuds de départ, ou NULL pour partir de tous les 
+ *        noeuds.
+ * @param nb_sources Le nombre de noeuds de départ (ignoré si sources vaut 
+ *        NULL).
+ * @param action La fonction appelée pour chaque couple trouvé.
+ * @param data Un pointeur transmis à 'action'.
+ */
+void requete_chemins(
+	const Graphe_etiquete * graphe, const Automate * requete,
+	const int * sources, int nb_sources,
+	void (* action)( int source, int noeud, void * data ), void * data
+);
+
+#endif
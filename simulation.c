@@ -0,0 +1,225 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2014, 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "simulation.h"
+#include "automate.h"
+#include "graphe.h"
+#include "ensemble.h"
+#include "outils.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+/*
+ * Renvoie 1 si, pour toute transition (p, l, p') de 'graphe', il existe une 
+ * transition (q, l, q') telle que q' simule p' pour la relation courante.
+ */
+int simulation_respectee(
+	const Graphe * graphe, const uint64_t * relation, size_t nb_mots,
+	int p, int q
+){
+	int l, k, j;
+	for( l=0; l<graphe->nb_lettres; l++ ){
+		int case_p = p*graphe->nb_lettres + l;
+		int case_q = q*graphe->nb_lettres + l;
+		for( k = graphe->debut[case_p]; k < graphe->debut[case_p+1]; k++ ){
+			const uint64_t * ligne = relation + graphe->fins[k] * nb_mots;
+			int trouve = 0;
+			for( j = graphe->debut[case_q]; j < graphe->debut[case_q+1]; j++ ){
+				if( TESTER_BIT( ligne, graphe->fins[j] ) ){
+					trouve = 1;
+					break;
+				}
+			}
+			if( ! trouve ) return 0;
+		}
+	}
+	return 1;
+}
+
+uint64_t * simulation_graphe( const Graphe * graphe ){
+	int n = graphe->nb_etats;
+	size_t nb_mots = NB_MOTS_BITS( n );
+	uint64_t * relation = xmalloc( ( n * nb_mots + 1 ) * sizeof(uint64_t) );
+	memset( relation, 0, ( n * nb_mots + 1 ) * sizeof(uint64_t) );
+	int p, q;
+
+	for( p=0; p<n; p++ ){
+		for( q=0; q<n; q++ ){
+			if( ! graphe->final[p] || graphe->final[q] ){
+				METTRE_BIT( relation + p*nb_mots, q );
+			}
+		}
+	}
+
+	int modification = 1;
+	while( modification ){
+		modification = 0;
+		for( p=0; p<n; p++ ){
+			uint64_t * ligne = relation + p*nb_mots;
+			for( q=0; q<n; q++ ){
+				if(
+					p != q && TESTER_BIT( ligne, q )
+					&& ! simulation_respectee( graphe, relation, nb_mots, p, q )
+				){
+					EFFACER_BIT( ligne, q );
+					modification = 1;
+				}
+			}
+		}
+	}
+	return relation;
+}
+
+uint64_t * simulation_directe( const Automate * automate ){
+	if( taille_ensemble( get_etats( automate ) ) > SIMULATION_MAX_ETATS ){
+		return NULL;
+	}
+	Graphe * graphe = creer_graphe( automate );
+	uint64_t * relation = simulation_graphe( graphe );
+	liberer_graphe( graphe );
+	return relation;
+}
+
+/*
+ * Quotiente l'automate par l'équivalence de simulation en avant, puis élague 
+ * les transitions et les états initiaux strictement dominés.
+ *
+ * Si q simule p, q simule aussi p dans l'automate quotient ; et si une 
+ * transition (p, a, q) est dominée par (p, a, q'), un mot accepté à partir de 
+ * q l'est à partir de q', par récurrence sur la longueur des mots : 
+ * l'élagage simultané de toutes les transitions dominées est donc correct.
+ */
+Automate * reduire_simulation_avant( const Automate * automate ){
+	Graphe * graphe = creer_graphe( automate );
+	int n = graphe->nb_etats;
+	int nb_lettres = graphe->nb_lettres;
+	size_t nb_mots = NB_MOTS_BITS( n );
+	uint64_t * relation = simulation_graphe( graphe );
+	int p, q, l, k, i;
+
+	// Le représentant d'une classe est son plus petit élément.
+	int * classe = xmalloc( ( n + 1 ) * sizeof(int) );
+	for( p=0; p<n; p++ ){
+		classe[p] = p;
+		for( q=0; q<p; q++ ){
+			if(
+				TESTER_BIT( relation + p*nb_mots, q )
+				&& TESTER_BIT( relation + q*nb_mots, p )
+			){
+				classe[p] = classe[q];
+				break;
+			}
+		}
+	}
+
+	Automate * res = creer_automate();
+	int * cibles = xmalloc( ( n + 1 ) * sizeof(int) );
+	uint64_t * vus = xmalloc( ( nb_mots + 1 ) * sizeof(uint64_t) );
+
+	for( p=0; p<n; p++ ){
+		if( classe[p] != p ) continue;
+		if( graphe->final[p] ) ajouter_etat_final( res, graphe->etats[p] );
+		for( l=0; l<nb_lettres; l++ ){
+			// Les cibles de la classe de p pour la lettre l, sans doublon.
+			int nb_cibles = 0;
+			memset( vus, 0, ( nb_mots + 1 ) * sizeof(uint64_t) );
+			for( i=p; i<n; i++ ){
+				if( classe[i] != p ) continue;
+				int c = i*nb_lettres + l;
+				for( k = graphe->debut[c]; k < graphe->debut[c+1]; k++ ){
+					int cible = classe[ graphe->fins[k] ];
+					if( ! TESTER_BIT( vus, cible ) ){
+						METTRE_BIT( vus, cible );
+						cibles[ nb_cibles++ ] = cible;
+					}
+				}
+			}
+			for( k=0; k<nb_cibles; k++ ){
+				int domine = 0;
+				for( i=0; i<nb_cibles && ! domine; i++ ){
+					domine = i != k
+						&& TESTER_BIT( relation + cibles[k]*nb_mots, cibles[i] );
+				}
+				if( ! domine ){
+					ajouter_transition(
+						res, graphe->etats[p], graphe->lettres[l],
+						graphe->etats[ cibles[k] ]
+					);
+				}
+			}
+		}
+	}
+
+	memset( vus, 0, ( nb_mots + 1 ) * sizeof(uint64_t) );
+	int nb_initiaux = 0;
+	for( k=0; k<graphe->nb_initiaux; k++ ){
+		int initial = classe[ graphe->initiaux[k] ];
+		if( ! TESTER_BIT( vus, initial ) ){
+			METTRE_BIT( vus, initial );
+			cibles[ nb_initiaux++ ] = initial;
+		}
+	}
+	for( k=0; k<nb_initiaux; k++ ){
+		int domine = 0;
+		for( i=0; i<nb_initiaux && ! domine; i++ ){
+			domine = i != k
+				&& TESTER_BIT( relation + cibles[k]*nb_mots, cibles[i] );
+		}
+		if( ! domine ) ajouter_etat_initial( res, graphe->etats[ cibles[k] ] );
+	}
+
+	xfree( vus );
+	xfree( cibles );
+	xfree( classe );
+	xfree( relation );
+	liberer_graphe( graphe );
+
+	Automate * accessible = automate_accessible( res );
+	liberer_automate( res );
+	return accessible;
+}
+
+void action_ajouter_lettre_simulation( const intptr_t element, void* data ){
+	ajouter_lettre( (Automate*) data, (char) element );
+}
+
+Automate * reduire_par_simulation( const Automate * automate ){
+	if( taille_ensemble( get_etats( automate ) ) > SIMULATION_MAX_ETATS ){
+		return copier_automate( automate );
+	}
+
+	Automate * avant = reduire_simulation_avant( automate );
+
+	// La simulation en arrière est la simulation en avant de l'automate miroir.
+	const Automate * miroir_avant = vue_miroir( avant );
+	Automate * arriere = reduire_simulation_avant( miroir_avant );
+	liberer_vue_miroir( miroir_avant );
+	liberer_automate( avant );
+	const Automate * res_miroir = vue_miroir( arriere );
+
+	Automate * res = automate_accessible( res_miroir );
+	liberer_vue_miroir( res_miroir );
+	liberer_automate( arriere );
+	pour_tout_element(
+		get_alphabet( automate ), action_ajouter_lettre_simulation, res
+	);
+	return res;
+}
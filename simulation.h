@@ -0,0 +1,72 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2014, 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file simulation.h */ 
+
+#ifndef __SIMULATION_H__
+#define __SIMULATION_H__
+
+#include "automate.h"
+
+#include <stdint.h>
+
+/**
+ * @brief Nombre d'états au-delà duquel la réduction par simulation n'est pas
+ *        effectuée (la relation de simulation occupe n*n bits).
+ */
+#define SIMULATION_MAX_ETATS 8192
+
+/**
+ * @brief Calcule la relation de simulation directe en avant d'un automate.
+ *
+ * L'état q simule l'état p si p final implique q final, et si pour toute 
+ * transition (p, a, p'), il existe une transition (q, a, q') telle que q' 
+ * simule p'. Si q simule p, le langage reconnu à partir de p est inclus dans 
+ * celui reconnu à partir de q.
+ *
+ * Les états sont désignés par leur rang dans get_etats(). La ligne p de la 
+ * relation occupe NB_MOTS_BITS(n) mots ; son bit q vaut 1 si q simule p.
+ * La mémoire du tableau renvoyé est laissée à la charge de l'utilisateur.
+ *
+ * @param automate Un automate.
+ * @return La relation, ou NULL si l'automate a plus de SIMULATION_MAX_ETATS
+ *         états.
+ */
+uint64_t * simulation_directe( const Automate * automate );
+
+/**
+ * @brief Réduit un automate à l'aide des préordres de simulation en avant et
+ *        en arrière.
+ *
+ * Pour chacun des deux préordres, les états équivalents sont fusionnés, puis 
+ * les transitions (p, a, q) telles qu'il existe une transition (p, a, q') où 
+ * q' simule strictement q sont supprimées, ainsi que les états devenus 
+ * inaccessibles. Le langage reconnu est inchangé et l'alphabet est conservé.
+ * Les états de l'automate obtenu sont des états de l'automate d'origine.
+ *
+ * Si l'automate a plus de SIMULATION_MAX_ETATS états, une copie de 
+ * l'automate est renvoyée.
+ *
+ * @param automate Un automate.
+ * @return L'automate réduit.
+ */
+Automate * reduire_par_simulation( const Automate * automate );
+
+#endif
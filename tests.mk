@@ -6,4 +6,28 @@ tests/test_creer_automate_minimal: tests/test_creer_automate_minimal.o libautoma
 tests/test_glushkov: tests/test_glushkov.o libautomate.a
 tests/test_suivant: tests/test_suivant.o libautomate.a
 tests/test_automate_miroir: tests/test_automate_miroir.o libautomate.a
+tests/test_dictionnaire: tests/test_dictionnaire.o libautomate.a
+tests/test_reduire_par_simulation: tests/test_reduire_par_simulation.o libautomate.a
+tests/test_determinisation: tests/test_determinisation.o libautomate.a
+tests/test_determinisation_parallele: tests/test_determinisation_parallele.o libautomate.a
+tests/test_budget: tests/test_budget.o libautomate.a
+tests/test_determinisation_externe: tests/test_determinisation_externe.o libautomate.a
+tests/test_estimation: tests/test_estimation.o libautomate.a
+tests/test_determinisation_incrementale: tests/test_determinisation_incrementale.o libautomate.a
+tests/test_produit: tests/test_produit.o libautomate.a
+tests/test_produit_parallele: tests/test_produit_parallele.o libautomate.a
+tests/test_inclusion: tests/test_inclusion.o libautomate.a
+tests/test_equivalence: tests/test_equivalence.o libautomate.a
+tests/test_signature_rationnel: tests/test_signature_rationnel.o libautomate.a
+tests/test_plus_courts_mots: tests/test_plus_courts_mots.o libautomate.a
+tests/test_accessibles: tests/test_accessibles.o libautomate.a
+tests/test_emonder: tests/test_emonder.o libautomate.a
+tests/test_antecedents: tests/test_antecedents.o libautomate.a
+tests/test_vue_miroir: tests/test_vue_miroir.o libautomate.a
+tests/test_composantes: tests/test_composantes.o libautomate.a
+tests/test_comptage: tests/test_comptage.o libautomate.a
+tests/test_enumeration: tests/test_enumeration.o libautomate.a
+tests/test_echantillonnage: tests/test_echantillonnage.o libautomate.a
+tests/test_accessibilite: tests/test_accessibilite.o libautomate.a
+tests/test_requetes_chemins: tests/test_requetes_chemins.o libautomate.a
 
@@ -0,0 +1,118 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "automate.h"
+#include "accessibilite.h"
+#include "budget.h"
+#include "outils.h"
+#include "ensemble.h"
+
+#include <stdlib.h>
+
+int test_accessibilite(){
+	int resultat = 1;
+
+	Automate * automate = creer_automate();
+	ajouter_transition( automate, 0, 'a', 1 );
+	ajouter_transition( automate, 1, 'a', 2 );
+	ajouter_transition( automate, 2, 'b', 1 );
+	ajouter_transition( automate, 2, 'a', 7 );
+	ajouter_etat( automate, 9 );
+
+	Accessibilite * accessibilite = creer_accessibilite( automate );
+	TEST(
+		1
+		&& peut_atteindre( accessibilite, 0, 7 )
+		&& peut_atteindre( accessibilite, 2, 1 )
+		&& peut_atteindre( accessibilite, 9, 9 )
+		&& ! peut_atteindre( accessibilite, 7, 0 )
+		&& ! peut_atteindre( accessibilite, 1, 0 )
+		&& ! peut_atteindre( accessibilite, 0, 9 )
+		&& peut_atteindre( accessibilite, 42, 42 )
+		&& ! peut_atteindre( accessibilite, 0, 42 ),
+		resultat
+	);
+	TEST( 
+		memoire_accessibilite( accessibilite ) 
+			== estimer_memoire_accessibilite( automate ), 
+		resultat 
+	);
+	liberer_accessibilite( accessibilite );
+
+	Budget budget;
+	initialiser_budget( &budget );
+	budget.max_octets = 1;
+	TEST(
+		1
+		&& creer_accessibilite_budget( automate, &budget, &accessibilite ) 
+			== BUDGET_MEMOIRE_DEPASSEE
+		&& accessibilite == NULL,
+		resultat
+	);
+	liberer_automate( automate );
+
+	// Comparaison avec etats_accessibles() sur des automates aléatoires, 
+	// dont certains ont plus de 64 composantes.
+	srand( 2015 );
+	int ok = 1;
+	int essai;
+	for( essai=0; essai<40; essai++ ){
+		automate = creer_automate();
+		int n = 1 + rand() % ( essai < 20 ? 10 : 150 );
+		int t;
+		for( t=0; t<n; t++ ){
+			ajouter_transition( automate, rand() % n, 'a' + rand() % 2, rand() % n );
+		}
+		accessibilite = creer_accessibilite( automate );
+		Ensemble_iterateur it;
+		for(
+			it = premier_iterateur_ensemble( get_etats( automate ) );
+			! iterateur_ensemble_est_vide( it );
+			it = iterateur_suivant_ensemble( it )
+		){
+			int origine = get_element( it );
+			Ensemble * atteints = etats_accessibles( automate, origine );
+			Ensemble_iterateur it_fin;
+			for(
+				it_fin = premier_iterateur_ensemble( get_etats( automate ) );
+				! iterateur_ensemble_est_vide( it_fin );
+				it_fin = iterateur_suivant_ensemble( it_fin )
+			){
+				int fin = get_element( it_fin );
+				ok &= peut_atteindre( accessibilite, origine, fin ) 
+					== est_dans_l_ensemble( atteints, fin );
+			}
+			liberer_ensemble( atteints );
+		}
+		liberer_accessibilite( accessibilite );
+		liberer_automate( automate );
+	}
+	TEST( ok, resultat );
+
+	return resultat;
+}
+
+int main(){
+
+	if( ! test_accessibilite() ){ return 1; }
+
+	return 0;
+}
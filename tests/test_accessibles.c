@@ -0,0 +1,98 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "automate.h"
+#include "outils.h"
+#include "ensemble.h"
+
+int test_accessibles(){
+	int resultat = 1;
+
+	// 0 -a-> 1 -b-> 2 -a-> 0, 3 -a-> 1, 4 isolé ; 0 et 4 initiaux.
+	Automate * automate = creer_automate();
+	ajouter_transition( automate, 0, 'a', 1 );
+	ajouter_transition( automate, 1, 'b', 2 );
+	ajouter_transition( automate, 2, 'a', 0 );
+	ajouter_transition( automate, 3, 'a', 1 );
+	ajouter_transition( automate, 3, 'c', 3 );
+	ajouter_etat_initial( automate, 0 );
+	ajouter_etat_initial( automate, 4 );
+	ajouter_etat_final( automate, 2 );
+	ajouter_etat_final( automate, 3 );
+
+	Ensemble * depuis_1 = etats_accessibles( automate, 1 );
+	Ensemble * depuis_3 = etats_accessibles( automate, 3 );
+	Ensemble * depuis_absent = etats_accessibles( automate, 7 );
+	Ensemble * access = accessibles( automate );
+	TEST(
+		1
+		&& taille_ensemble( depuis_1 ) == 3
+		&& ! est_dans_l_ensemble( depuis_1, 3 )
+		&& taille_ensemble( depuis_3 ) == 4
+		&& taille_ensemble( depuis_absent ) == 1
+		&& est_dans_l_ensemble( depuis_absent, 7 )
+		&& taille_ensemble( access ) == 4
+		&& est_dans_l_ensemble( access, 4 )
+		&& ! est_dans_l_ensemble( access, 3 ),
+		resultat
+	);
+	liberer_ensemble( depuis_1 );
+	liberer_ensemble( depuis_3 );
+	liberer_ensemble( depuis_absent );
+	liberer_ensemble( access );
+
+	Automate * accessible = automate_accessible( automate );
+	TEST(
+		1
+		&& taille_ensemble( get_etats( accessible ) ) == 4
+		&& taille_ensemble( get_finaux( accessible ) ) == 1
+		&& taille_ensemble( get_initiaux( accessible ) ) == 2
+		&& taille_ensemble( get_alphabet( accessible ) ) == 3
+		&& nombre_de_transitions( accessible ) == 3
+		&& le_mot_est_reconnu( accessible, "abaab" ),
+		resultat
+	);
+	liberer_automate( accessible );
+	liberer_automate( automate );
+
+	// Une longue chaîne : le parcours est linéaire.
+	int n = 100000;
+	automate = creer_automate();
+	ajouter_etat_initial( automate, 0 );
+	int i;
+	for( i=0; i<n; i++ ) ajouter_transition( automate, i, 'a' + i % 2, i+1 );
+	ajouter_etat( automate, n+5 );
+	access = accessibles( automate );
+	TEST( 
+		taille_ensemble( access ) == n+1 && ! est_dans_l_ensemble( access, n+5 ), 
+		resultat 
+	);
+	liberer_ensemble( access );
+	liberer_automate( automate );
+
+	return resultat;
+}
+
+int main(){
+
+	if( ! test_accessibles() ){ return 1; }
+
+	return 0;
+}
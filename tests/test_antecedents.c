@@ -0,0 +1,107 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "automate.h"
+#include "outils.h"
+#include "ensemble.h"
+
+#include <stdlib.h>
+
+typedef struct {
+	const Automate * automate;
+	int ok;
+} Verification_antecedents;
+
+void verifier_antecedent( int origine, char lettre, int fin, void* data ){
+	Verification_antecedents * v = data;
+	v->ok &= est_dans_l_ensemble( antecedents( v->automate, fin, lettre ), origine );
+}
+
+int test_antecedents(){
+	int resultat = 1;
+
+	Automate * automate = creer_automate();
+	ajouter_transition( automate, 0, 'a', 1 );
+	ajouter_transition( automate, 2, 'a', 1 );
+	ajouter_transition( automate, 1, 'b', 1 );
+
+	// Index construit à partir des transitions existantes...
+	indexer_antecedents( automate );
+	TEST(
+		1
+		&& taille_ensemble( antecedents( automate, 1, 'a' ) ) == 2
+		&& est_dans_l_ensemble( antecedents( automate, 1, 'a' ), 0 )
+		&& est_dans_l_ensemble( antecedents( automate, 1, 'a' ), 2 )
+		&& taille_ensemble( antecedents( automate, 1, 'b' ) ) == 1
+		&& taille_ensemble( antecedents( automate, 0, 'a' ) ) == 0,
+		resultat
+	);
+
+	// ... puis mis à jour par ajouter_transition().
+	ajouter_transition( automate, 3, 'a', 1 );
+	ajouter_transition( automate, 3, 'b', 0 );
+	ajouter_transition( automate, 0, 'a', 1 );
+	indexer_antecedents( automate );
+	TEST(
+		1
+		&& taille_ensemble( antecedents( automate, 1, 'a' ) ) == 3
+		&& est_dans_l_ensemble( antecedents( automate, 1, 'a' ), 3 )
+		&& taille_ensemble( antecedents( automate, 0, 'b' ) ) == 1,
+		resultat
+	);
+	liberer_automate( automate );
+
+	// L'index contient exactement les transitions, quel que soit le moment 
+	// où il est activé.
+	srand( 2015 );
+	int ok = 1;
+	int essai;
+	for( essai=0; essai<50; essai++ ){
+		automate = creer_automate();
+		int n = 1 + rand() % 10;
+		int t;
+		for( t=0; t<4*n; t++ ){
+			if( t == 2*n ) indexer_antecedents( automate );
+			ajouter_transition( automate, rand() % n, 'a' + rand() % 3, rand() % n );
+		}
+		Verification_antecedents v = { automate, 1 };
+		pour_toute_transition( automate, verifier_antecedent, &v );
+		int nb_antecedents = 0;
+		int fin;
+		char lettre;
+		for( fin=0; fin<n; fin++ ){
+			for( lettre='a'; lettre<='c'; lettre++ ){
+				nb_antecedents += taille_ensemble( antecedents( automate, fin, lettre ) );
+			}
+		}
+		ok &= v.ok && nb_antecedents == nombre_de_transitions( automate );
+		liberer_automate( automate );
+	}
+	TEST( ok, resultat );
+
+	return resultat;
+}
+
+int main(){
+
+	if( ! test_antecedents() ){ return 1; }
+
+	return 0;
+}
@@ -0,0 +1,126 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+
+
+#include "automate.h"
+#include "rationnel.h"
+#include "budget.h"
+#include "outils.h"
+#include "ensemble.h"
+
+// (a+b)*.a.(a+b)^k : 2^(k+1) états une fois déterminisé.
+Automate * creer_automate_exponentiel( int k ){
+	Automate * automate = creer_automate();
+	ajouter_etat_initial( automate, 0 );
+	ajouter_transition( automate, 0, 'a', 0 );
+	ajouter_transition( automate, 0, 'b', 0 );
+	ajouter_transition( automate, 0, 'a', 1 );
+	int i;
+	for( i=1; i<=k; i++ ){
+		ajouter_transition( automate, i, 'a', i+1 );
+		ajouter_transition( automate, i, 'b', i+1 );
+	}
+	ajouter_etat_final( automate, k+1 );
+	return automate;
+}
+
+int test_budget_determinisation(){
+	int resultat = 1;
+
+	Automate * automate = creer_automate_exponentiel( 8 );
+	Automate * res;
+	Budget budget;
+
+	initialiser_budget( &budget );
+	Statut_budget statut = creer_automate_deterministe_budget( automate, &budget, &res );
+	TEST(
+		1
+		&& statut == BUDGET_RESPECTE
+		&& res
+		&& taille_ensemble( get_etats( res ) ) == 1 << 9
+		&& le_mot_est_reconnu( res, "abbbbbbbb" ),
+		resultat
+	);
+	liberer_automate( res );
+
+	budget.max_etats = 100;
+	statut = creer_automate_deterministe_budget( automate, &budget, &res );
+	TEST( statut == BUDGET_ETATS_DEPASSE && ! res, resultat );
+	statut = creer_automate_minimal_budget( automate, &budget, &res );
+	TEST( statut == BUDGET_ETATS_DEPASSE && ! res, resultat );
+
+	initialiser_budget( &budget );
+	budget.max_octets = 1000;
+	statut = creer_automate_deterministe_budget( automate, &budget, &res );
+	TEST( statut == BUDGET_MEMOIRE_DEPASSEE && ! res, resultat );
+
+	initialiser_budget( &budget );
+	annuler_budget( &budget );
+	statut = creer_automate_minimal_budget( automate, &budget, &res );
+	TEST( statut == BUDGET_ANNULE && ! res, resultat );
+	liberer_automate( automate );
+
+	// 2^23 états : impossible en 10 ms.
+	automate = creer_automate_exponentiel( 22 );
+	initialiser_budget( &budget );
+	fixer_delai_budget( &budget, 0.01 );
+	statut = creer_automate_deterministe_budget( automate, &budget, &res );
+	TEST( statut == BUDGET_DELAI_DEPASSE && ! res, resultat );
+	liberer_automate( automate );
+
+	return resultat;
+}
+
+int test_budget_rationnel(){
+	int resultat = 1;
+
+	Budget budget;
+	initialiser_budget( &budget );
+	bool egaux = false;
+	Statut_budget statut = 
+		meme_langage_budget( "(a*.b*)*", "(a+b)*", &budget, &egaux );
+	TEST( statut == BUDGET_RESPECTE && egaux, resultat );
+
+	budget.max_etats = 3;
+	statut = meme_langage_budget( 
+		"(a+b)*.a.(a+b).(a+b)", "(a+b)*.a.(a+b).(a+b)", &budget, &egaux
+	);
+	TEST( statut == BUDGET_ETATS_DEPASSE, resultat );
+
+	Automate * automate = creer_automate_exponentiel( 3 );
+	Rationnel * expr;
+	initialiser_budget( &budget );
+	budget.max_octets = 100 * sizeof(Rationnel);
+	statut = Arden_budget( automate, &budget, &expr );
+	TEST( statut == BUDGET_MEMOIRE_DEPASSEE && ! expr, resultat );
+	liberer_automate( automate );
+
+	return resultat;
+}
+
+int main(){
+
+	if( ! test_budget_determinisation() ){ return 1; }
+	if( ! test_budget_rationnel() ){ return 1; }
+
+	return 0;
+}
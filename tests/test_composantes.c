@@ -0,0 +1,189 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "automate.h"
+#include "composantes.h"
+#include "equivalence.h"
+#include "outils.h"
+#include "ensemble.h"
+
+#include <stdlib.h>
+
+Automate * minimal_par_brzozowski( const Automate * automate ){
+	Automate * res = copier_automate( automate );
+	int etape;
+	for( etape=0; etape<2; etape++ ){
+		Automate * renverse = miroir( res );
+		Automate * emonde = emonder( renverse );
+		liberer_automate( res );
+		res = creer_automate_deterministe( emonde );
+		liberer_automate( renverse );
+		liberer_automate( emonde );
+	}
+	return res;
+}
+
+int test_composantes(){
+	int resultat = 1;
+
+	// 0 -> {1,2} -> 3 -> 4 -> 3, 5 isolé avec une boucle.
+	Automate * automate = creer_automate();
+	ajouter_transition( automate, 0, 'a', 1 );
+	ajouter_transition( automate, 1, 'a', 2 );
+	ajouter_transition( automate, 2, 'b', 1 );
+	ajouter_transition( automate, 2, 'a', 3 );
+	ajouter_transition( automate, 1, 'b', 3 );
+	ajouter_transition( automate, 3, 'a', 4 );
+	ajouter_transition( automate, 4, 'b', 3 );
+	ajouter_transition( automate, 5, 'a', 5 );
+	ajouter_etat_initial( automate, 0 );
+	ajouter_etat_final( automate, 2 );
+
+	Graphe * graphe = creer_graphe( automate );
+	Composantes * composantes = creer_composantes( graphe );
+	int * c = composantes->composante;
+	int ok = composantes->nb_composantes == 4;
+	ok &= c[1] == c[2] && c[3] == c[4] && c[0] != c[1] && c[1] != c[3];
+	ok &= c[0] < c[1] && c[1] < c[3];
+	ok &= ! composantes->cyclique[ c[0] ] && composantes->cyclique[ c[1] ]
+		&& composantes->cyclique[ c[3] ] && composantes->cyclique[ c[5] ];
+	ok &= composantes->debut_successeurs[ c[1] + 1 ] 
+		- composantes->debut_successeurs[ c[1] ] == 1;
+	int i, k;
+	for( i=0; i<graphe->nb_etats; i++ ){
+		for( 
+			k=graphe->debut[ i * graphe->nb_lettres ]; 
+			k<graphe->debut[ ( i + 1 ) * graphe->nb_lettres ]; 
+			k++ 
+		){
+			ok &= c[i] <= c[ graphe->fins[k] ];
+		}
+	}
+	TEST( ok, resultat );
+	liberer_composantes( composantes );
+	liberer_graphe( graphe );
+
+	Ensemble * cycle = etats_sur_un_cycle( automate );
+	TEST(
+		1
+		&& taille_ensemble( cycle ) == 5
+		&& ! est_dans_l_ensemble( cycle, 0 ),
+		resultat
+	);
+	liberer_ensemble( cycle );
+
+	// Le cycle 1 <-> 2 passe par un état utile, pas le cycle 3 <-> 4.
+	int longueur = 0;
+	TEST( ! langage_est_fini( automate ), resultat );
+	TEST( ! longueur_maximale_mot( automate, &longueur ), resultat );
+	liberer_automate( automate );
+
+	automate = creer_automate();
+	ajouter_transition( automate, 0, 'a', 1 );
+	ajouter_transition( automate, 1, 'b', 2 );
+	ajouter_transition( automate, 0, 'b', 2 );
+	ajouter_transition( automate, 2, 'a', 3 );
+	ajouter_transition( automate, 3, 'a', 3 );
+	ajouter_etat_initial( automate, 0 );
+	ajouter_etat_final( automate, 2 );
+	TEST(
+		1
+		&& langage_est_fini( automate )
+		&& longueur_maximale_mot( automate, &longueur )
+		&& longueur == 2,
+		resultat
+	);
+	Automate * minimal = creer_automate_minimal( automate );
+	// {b, ab} : 0 -a-> 1 -b-> 2, 0 -b-> 2, et le puits.
+	TEST(
+		1
+		&& taille_ensemble( get_etats( minimal ) ) == 4
+		&& equivalent( minimal, automate, NULL ),
+		resultat
+	);
+	liberer_automate( minimal );
+	liberer_automate( automate );
+
+	// Langage vide.
+	automate = creer_automate();
+	ajouter_transition( automate, 0, 'a', 0 );
+	ajouter_etat_initial( automate, 0 );
+	TEST(
+		1
+		&& longueur_maximale_mot( automate, &longueur )
+		&& longueur == -1,
+		resultat
+	);
+	liberer_automate( automate );
+
+	// Une longue chaîne ne doit pas épuiser la pile d'appels.
+	automate = creer_automate();
+	for( i=0; i<100000; i++ ){
+		ajouter_transition( automate, i, 'a', i + 1 );
+	}
+	ajouter_etat_initial( automate, 0 );
+	ajouter_etat_final( automate, 100000 );
+	TEST(
+		1
+		&& longueur_maximale_mot( automate, &longueur )
+		&& longueur == 100000,
+		resultat
+	);
+	liberer_automate( automate );
+
+	// Automates acycliques aléatoires : la minimisation acyclique donne
+	// le même nombre d'états que l'algorithme de Brzozowski.
+	srand( 2015 );
+	ok = 1;
+	int essai;
+	for( essai=0; essai<100; essai++ ){
+		automate = creer_automate();
+		int n = 2 + rand() % 10;
+		int t;
+		for( t=0; t<2*n; t++ ){
+			int origine = rand() % ( n - 1 );
+			int fin = origine + 1 + rand() % ( n - 1 - origine );
+			ajouter_transition( automate, origine, 'a' + rand() % 2, fin );
+		}
+		ajouter_etat_initial( automate, 0 );
+		ajouter_etat_final( automate, n - 1 );
+		ajouter_etat_final( automate, rand() % n );
+		ok &= langage_est_fini( automate );
+		minimal = creer_automate_minimal( automate );
+		Automate * brzozowski = minimal_par_brzozowski( automate );
+		ok &= equivalent( minimal, automate, NULL );
+		ok &= taille_ensemble( get_etats( minimal ) ) 
+			== taille_ensemble( get_etats( brzozowski ) );
+		liberer_automate( minimal );
+		liberer_automate( brzozowski );
+		liberer_automate( automate );
+	}
+	TEST( ok, resultat );
+
+	return resultat;
+}
+
+int main(){
+
+	if( ! test_composantes() ){ return 1; }
+
+	return 0;
+}
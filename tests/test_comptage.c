@@ -0,0 +1,140 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "automate.h"
+#include "comptage.h"
+#include "outils.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+uint64_t puissance_modulo_test( uint64_t x, uint64_t n, uint64_t modulo ){
+	uint64_t res = 1 % modulo;
+	while( n ){
+		if( n & 1 ) res = (unsigned __int128) res * x % modulo;
+		x = (unsigned __int128) x * x % modulo;
+		n >>= 1;
+	}
+	return res;
+}
+
+int test_comptage(){
+	int resultat = 1;
+	const uint64_t modulo = 1000000007;
+
+	// Tous les mots sur {a, b} : 2^n mots de longueur n.
+	Automate * automate = creer_automate();
+	ajouter_transition( automate, 0, 'a', 0 );
+	ajouter_transition( automate, 0, 'b', 0 );
+	ajouter_etat_initial( automate, 0 );
+	ajouter_etat_final( automate, 0 );
+
+	char * compte = nombre_de_mots( automate, 100 );
+	TEST( strcmp( compte, "1267650600228229401496703205376" ) == 0, resultat );
+	xfree( compte );
+	compte = nombre_de_mots( automate, 0 );
+	TEST( strcmp( compte, "1" ) == 0, resultat );
+	xfree( compte );
+	TEST(
+		1
+		&& nombre_de_mots_modulo( automate, 1000000, modulo ) 
+			== puissance_modulo_test( 2, 1000000, modulo )
+		&& nombre_de_mots_modulo( automate, 1000000000000000000ULL, modulo ) 
+			== puissance_modulo_test( 2, 1000000000000000000ULL, modulo ),
+		resultat
+	);
+	liberer_automate( automate );
+
+	// Mots sans facteur bb : F(n+2) mots de longueur n.
+	automate = creer_automate();
+	ajouter_transition( automate, 0, 'a', 0 );
+	ajouter_transition( automate, 0, 'b', 1 );
+	ajouter_transition( automate, 1, 'a', 0 );
+	ajouter_transition( automate, 1, 'b', 2 );
+	ajouter_transition( automate, 2, 'a', 2 );
+	ajouter_transition( automate, 2, 'b', 2 );
+	ajouter_etat_initial( automate, 0 );
+	ajouter_etat_final( automate, 0 );
+	ajouter_etat_final( automate, 1 );
+
+	uint64_t * suite = suite_nombre_de_mots_modulo( automate, 90, UINT64_MAX );
+	TEST(
+		1
+		&& suite[0] == 1 && suite[1] == 2 && suite[2] == 3 && suite[3] == 5
+		&& suite[90] == 7540113804746346429ULL,
+		resultat
+	);
+	compte = nombre_de_mots( automate, 90 );
+	TEST( strcmp( compte, "7540113804746346429" ) == 0, resultat );
+	xfree( compte );
+	xfree( suite );
+	liberer_automate( automate );
+
+	// Langage vide.
+	automate = creer_automate();
+	ajouter_transition( automate, 0, 'a', 1 );
+	ajouter_etat_initial( automate, 0 );
+	compte = nombre_de_mots( automate, 3 );
+	TEST( 
+		1
+		&& strcmp( compte, "0" ) == 0
+		&& nombre_de_mots_modulo( automate, 1, modulo ) == 0, 
+		resultat 
+	);
+	xfree( compte );
+	liberer_automate( automate );
+
+	// Automates déterministes aléatoires : la propagation et l'exponentiation
+	// de la matrice de transfert donnent les mêmes comptes.
+	srand( 2015 );
+	int ok = 1;
+	int essai;
+	for( essai=0; essai<30; essai++ ){
+		Automate * aleatoire = creer_automate();
+		int nb = 1 + rand() % 6;
+		int t;
+		for( t=0; t<3*nb; t++ ){
+			ajouter_transition( aleatoire, rand() % nb, 'a' + rand() % 3, rand() % nb );
+		}
+		ajouter_etat_initial( aleatoire, 0 );
+		ajouter_etat_final( aleatoire, rand() % nb );
+		automate = creer_automate_deterministe( aleatoire );
+		suite = suite_nombre_de_mots_modulo( automate, 3000, modulo );
+		ok &= suite[3000] == nombre_de_mots_modulo( automate, 3000, modulo );
+		ok &= suite[17] == nombre_de_mots_modulo( automate, 17, modulo );
+		compte = nombre_de_mots( automate, 17 );
+		ok &= strtoull( compte, NULL, 10 ) % modulo == suite[17];
+		xfree( compte );
+		xfree( suite );
+		liberer_automate( automate );
+		liberer_automate( aleatoire );
+	}
+	TEST( ok, resultat );
+
+	return resultat;
+}
+
+int main(){
+
+	if( ! test_comptage() ){ return 1; }
+
+	return 0;
+}
@@ -0,0 +1,117 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+
+#include "automate.h"
+#include "determinisation.h"
+#include "vecteurs.h"
+#include "outils.h"
+#include "ensemble.h"
+
+int test_table_vecteurs(){
+	int resultat = 1;
+
+	Table_vecteurs * table = creer_table_vecteurs();
+	uint64_t v[3];
+	int ok = 1;
+	int nouveau;
+	int i;
+	for( i=0; i<1000; i++ ){
+		v[0] = i; v[1] = i % 7; v[2] = 42;
+		ok &= interner_vecteur( table, v, 1 + i % 3, &nouveau ) == i && nouveau;
+	}
+	for( i=0; i<1000; i++ ){
+		v[0] = i; v[1] = i % 7; v[2] = 42;
+		ok &= interner_vecteur( table, v, 1 + i % 3, &nouveau ) == i && ! nouveau;
+		ok &= trouver_vecteur( table, v, 1 + i % 3 ) == i;
+	}
+	v[0] = 3;
+	int nb_mots;
+	const uint64_t * w = get_vecteur( table, 5, &nb_mots );
+
+	TEST(
+		1
+		&& ok
+		&& trouver_vecteur( table, v, 3 ) == -1
+		&& taille_table_vecteurs( table ) == 1000
+		&& nb_mots == 3 && w[0] == 5 && w[1] == 5 && w[2] == 42,
+		resultat
+	);
+
+	liberer_table_vecteurs( table );
+	return resultat;
+}
+
+int test_determinisation(){
+	int resultat = 1;
+
+	// (a+b)*.a.(a+b)^k : 2^(k+1) parties accessibles.
+	int k = 8;
+	Automate * automate = creer_automate();
+	ajouter_etat_initial( automate, 0 );
+	ajouter_transition( automate, 0, 'a', 0 );
+	ajouter_transition( automate, 0, 'b', 0 );
+	ajouter_transition( automate, 0, 'a', 1 );
+	int i;
+	for( i=1; i<=k; i++ ){
+		ajouter_transition( automate, i, 'a', i+1 );
+		ajouter_transition( automate, i, 'b', i+1 );
+	}
+	ajouter_etat_final( automate, k+1 );
+
+	Determinisation * d = creer_determinisation( automate );
+	int etat_a = successeur_determinisation( d, 0, 0 );
+	int etat_b = successeur_determinisation( d, 0, 1 );
+
+	TEST(
+		1
+		&& nombre_etats_determinisation( d ) == 2
+		&& etat_a == 1 && etat_b == 0
+		&& taille_partie_determinisation( d, 1 ) == 2
+		&& ! est_final_determinisation( d, 1 )
+		&& successeur_determinisation( d, 0, 0 ) == 1
+		&& nombre_etats_determinisation( d ) == 2,
+		resultat
+	);
+	liberer_determinisation( d );
+
+	Automate * deterministe = creer_automate_deterministe( automate );
+	TEST(
+		1
+		&& taille_ensemble( get_etats( deterministe ) ) == 1 << (k+1)
+		&& nombre_de_transitions( deterministe ) == 2 << (k+1)
+		&& le_mot_est_reconnu( deterministe, "abbbbbbbb" )
+		&& ! le_mot_est_reconnu( deterministe, "babbbbbbb" ),
+		resultat
+	);
+
+	liberer_automate( deterministe );
+	liberer_automate( automate );
+	return resultat;
+}
+
+int main(){
+
+	if( ! test_table_vecteurs() ){ return 1; }
+	if( ! test_determinisation() ){ return 1; }
+
+	return 0;
+}
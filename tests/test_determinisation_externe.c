@@ -0,0 +1,164 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+
+
+#include "automate.h"
+#include "determinisation_externe.h"
+#include "outils.h"
+#include "ensemble.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*
+ * Vérifie que deux automates reconnaissent les mêmes mots de longueur au 
+ * plus 'longueur' sur l'alphabet donné.
+ */
+int memes_mots_courts_externe( 
+	const Automate * a1, const Automate * a2, const char * alphabet, int longueur 
+){
+	int nb_lettres = strlen( alphabet );
+	char mot[32];
+	int indices[32];
+	int n, i;
+	for( n=0; n<=longueur; n++ ){
+		for( i=0; i<n; i++ ) indices[i] = 0;
+		while( 1 ){
+			for( i=0; i<n; i++ ) mot[i] = alphabet[ indices[i] ];
+			mot[n] = '\0';
+			if( le_mot_est_reconnu( a1, mot ) != le_mot_est_reconnu( a2, mot ) ){
+				return 0;
+			}
+			for( i=n-1; i>=0 && indices[i] == nb_lettres-1; i-- ) indices[i] = 0;
+			if( i < 0 ) break;
+			indices[i]++;
+		}
+	}
+	return 1;
+}
+
+int meme_determinisation_externe( const Automate * automate, size_t memoire ){
+	Statistiques_determinisation_externe stats;
+	if( 
+		determiniser_sur_disque( automate, "afd_externe.tmp", ".", memoire, &stats ) 
+	){
+		return 0;
+	}
+	Automate * externe = charger_automate_sur_disque( "afd_externe.tmp" );
+	remove( "afd_externe.tmp" );
+	if( ! externe ) return 0;
+	Automate * interne = creer_automate_deterministe( automate );
+	int ok = 
+		taille_ensemble( get_etats( externe ) ) == taille_ensemble( get_etats( interne ) )
+		&& stats.nb_etats == taille_ensemble( get_etats( interne ) )
+		&& stats.nb_transitions == nombre_de_transitions( interne )
+		&& nombre_de_transitions( externe ) == nombre_de_transitions( interne )
+		&& memes_mots_courts_externe( externe, interne, "abc", 7 );
+	liberer_automate( interne );
+	liberer_automate( externe );
+	return ok;
+}
+
+int test_determinisation_externe(){
+	int resultat = 1;
+
+	// (a+b)*.a.(a+b)^k : 2^(k+1) parties accessibles.
+	int k = 7;
+	Automate * automate = creer_automate();
+	ajouter_etat_initial( automate, 0 );
+	ajouter_transition( automate, 0, 'a', 0 );
+	ajouter_transition( automate, 0, 'b', 0 );
+	ajouter_transition( automate, 0, 'a', 1 );
+	int i;
+	for( i=1; i<=k; i++ ){
+		ajouter_transition( automate, i, 'a', i+1 );
+		ajouter_transition( automate, i, 'b', i+1 );
+	}
+	ajouter_etat_final( automate, k+1 );
+
+	Statistiques_determinisation_externe stats;
+	int erreur = determiniser_sur_disque( 
+		automate, "afd_externe.tmp", ".", 1 << 20, &stats 
+	);
+	Automate * externe = charger_automate_sur_disque( "afd_externe.tmp" );
+	remove( "afd_externe.tmp" );
+	TEST(
+		1
+		&& ! erreur
+		&& externe
+		&& stats.nb_etats == 1 << (k+1)
+		&& stats.nb_sequences == stats.nb_niveaux
+		&& taille_ensemble( get_etats( externe ) ) == 1 << (k+1)
+		&& le_mot_est_reconnu( externe, "abbbbbbb" )
+		&& ! le_mot_est_reconnu( externe, "abbbbbbbb" ),
+		resultat
+	);
+	if( externe ) liberer_automate( externe );
+
+	// Très peu de mémoire : beaucoup de séquences, fusionnées en plusieurs 
+	// passes.
+	determiniser_sur_disque( automate, "afd_externe.tmp", ".", 256, &stats );
+	remove( "afd_externe.tmp" );
+	TEST( 
+		1
+		&& stats.nb_sequences > 64 
+		&& meme_determinisation_externe( automate, 256 ), 
+		resultat 
+	);
+
+	TEST( 
+		1
+		&& determiniser_sur_disque( automate, "afd_externe.tmp", "/inexistant", 1024, NULL ) == -1
+		&& ! charger_automate_sur_disque( "/inexistant/afd" ),
+		resultat
+	);
+	liberer_automate( automate );
+
+	// Automates non déterministes tirés au hasard.
+	srand( 2015 );
+	int ok = 1;
+	int essai;
+	for( essai=0; essai<30; essai++ ){
+		automate = creer_automate();
+		int n = 2 + rand() % 10;
+		ajouter_etat_initial( automate, rand() % n );
+		ajouter_etat_initial( automate, rand() % n );
+		ajouter_etat_final( automate, rand() % n );
+		int t;
+		for( t=0; t<3*n; t++ ){
+			ajouter_transition( automate, rand() % n, 'a' + rand() % 3, rand() % n );
+		}
+		ok &= meme_determinisation_externe( automate, 512 );
+		liberer_automate( automate );
+	}
+	TEST( ok, resultat );
+
+	return resultat;
+}
+
+int main(){
+
+	if( ! test_determinisation_externe() ){ return 1; }
+
+	return 0;
+}
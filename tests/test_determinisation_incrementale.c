@@ -0,0 +1,238 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+
+
+#include "automate.h"
+#include "determinisation_incrementale.h"
+#include "outils.h"
+#include "ensemble.h"
+
+#include <stdlib.h>
+
+int successeur_unique( const Automate * automate, int etat, char lettre ){
+	const Ensemble * fins = voisins( automate, etat, lettre );
+	if( taille_ensemble( fins ) != 1 ) return -1;
+	return get_element( premier_iterateur_ensemble( fins ) );
+}
+
+/*
+ * Les deux automates sont déterministes, complets et accessibles : ils sont 
+ * isomorphes si le parcours simultané depuis les états initiaux définit une 
+ * bijection qui respecte les états finaux.
+ */
+int isomorphe_a_la_reconstruction( Determinisation_incrementale * d, const Automate * source ){
+	const Automate * incremental = automate_deterministe_incremental( d );
+	Automate * complet = creer_automate_deterministe( source );
+	int nb_etats = taille_ensemble( get_etats( complet ) );
+	int ok = 
+		taille_ensemble( get_etats( incremental ) ) == nb_etats
+		&& nombre_de_transitions( incremental ) == nombre_de_transitions( complet )
+		&& taille_ensemble( get_finaux( incremental ) ) 
+			== taille_ensemble( get_finaux( complet ) )
+		&& taille_ensemble( get_initiaux( incremental ) ) == 1
+		&& comparer_ensemble( get_alphabet( incremental ), get_alphabet( complet ) ) == 0;
+	if( ! ok ){
+		liberer_automate( complet );
+		return 0;
+	}
+
+	int max_i = get_max_etat( incremental ) + 1;
+	int max_c = get_max_etat( complet ) + 1;
+	int * image = xmalloc( max_i * sizeof(int) );
+	int * antecedent = xmalloc( max_c * sizeof(int) );
+	int * pile = xmalloc( max_i * sizeof(int) );
+	int i;
+	for( i=0; i<max_i; i++ ) image[i] = -1;
+	for( i=0; i<max_c; i++ ) antecedent[i] = -1;
+	int x = get_element( premier_iterateur_ensemble( get_initiaux( incremental ) ) );
+	int y = get_element( premier_iterateur_ensemble( get_initiaux( complet ) ) );
+	image[x] = y;
+	antecedent[y] = x;
+	int sommet = 0;
+	pile[ sommet++ ] = x;
+	while( ok && sommet > 0 ){
+		x = pile[ --sommet ];
+		y = image[x];
+		ok &= est_un_etat_final_de_l_automate( incremental, x ) 
+			== est_un_etat_final_de_l_automate( complet, y );
+		Ensemble_iterateur it;
+		for(
+			it = premier_iterateur_ensemble( get_alphabet( complet ) );
+			ok && ! iterateur_ensemble_est_vide( it );
+			it = iterateur_suivant_ensemble( it )
+		){
+			char lettre = (char) get_element( it );
+			int u = successeur_unique( incremental, x, lettre );
+			int v = successeur_unique( complet, y, lettre );
+			if( u < 0 || v < 0 ){
+				ok = 0;
+			}else if( image[u] < 0 ){
+				ok &= antecedent[v] < 0;
+				image[u] = v;
+				antecedent[v] = u;
+				pile[ sommet++ ] = u;
+			}else{
+				ok &= image[u] == v;
+			}
+		}
+	}
+	xfree( image );
+	xfree( antecedent );
+	xfree( pile );
+	liberer_automate( complet );
+	return ok;
+}
+
+int test_determinisation_incrementale(){
+	int resultat = 1;
+
+	// (a+b)*.a.(a+b)^k, puis une transition ajoutée en fin de chaîne.
+	int k = 8;
+	Automate * automate = creer_automate();
+	ajouter_etat_initial( automate, 0 );
+	ajouter_transition( automate, 0, 'a', 0 );
+	ajouter_transition( automate, 0, 'b', 0 );
+	ajouter_transition( automate, 0, 'a', 1 );
+	int i;
+	for( i=1; i<=k; i++ ){
+		ajouter_transition( automate, i, 'a', i+1 );
+		ajouter_transition( automate, i, 'b', i+1 );
+	}
+	ajouter_etat_final( automate, k+1 );
+
+	Determinisation_incrementale * d = creer_determinisation_incrementale( automate );
+	const Automate * deterministe = automate_deterministe_incremental( d );
+	int ok = isomorphe_a_la_reconstruction( d, automate );
+	long nb_images = nombre_images_calculees( d );
+	long nb_retouches = nombre_retouches_incrementales( d );
+	int nb_transitions = nombre_de_transitions( deterministe );
+
+	// Reconstruire sans modification ne recalcule ni ne retouche rien.
+	ok &= isomorphe_a_la_reconstruction( d, automate );
+	long nb_images_2 = nombre_images_calculees( d );
+	long nb_retouches_2 = nombre_retouches_incrementales( d );
+
+	// Seules les parties contenant k+1 sont touchées : les transitions par 
+	// 'b' des autres parties restent valides, et leurs lignes ne sont pas 
+	// retouchées dans l'automate conservé.
+	ajouter_transition( automate, k+1, 'b', 1 );
+	ok &= isomorphe_a_la_reconstruction( d, automate );
+	long nb_images_3 = nombre_images_calculees( d );
+	long nb_retouches_3 = nombre_retouches_incrementales( d );
+
+	TEST(
+		1
+		&& ok
+		&& automate_deterministe_incremental( d ) == deterministe
+		&& nb_images == 2 << (k+1)
+		&& nb_images_2 == nb_images
+		&& nb_images_3 > nb_images
+		&& nb_images_3 - nb_images < 2 << (k+1)
+		&& nb_retouches_2 == nb_retouches
+		&& nb_retouches_3 > nb_retouches
+		&& nb_retouches_3 - nb_retouches < nb_transitions,
+		resultat
+	);
+
+	// Une transition vers un nouvel état crée des parties, que son retrait 
+	// rend inaccessibles ; elles restent mémorisées jusqu'au compactage.
+	retirer_transition( automate, k+1, 'b', 1 );
+	ok = isomorphe_a_la_reconstruction( d, automate );
+	ajouter_transition( automate, k, 'b', k+2 );
+	ok &= isomorphe_a_la_reconstruction( d, automate );
+	retirer_transition( automate, k, 'b', k+2 );
+	ok &= isomorphe_a_la_reconstruction( d, automate );
+	int nb_parties = nombre_parties_memorisees( d );
+	compacter_determinisation_incrementale( d );
+	deterministe = automate_deterministe_incremental( d );
+	long nb_images_4 = nombre_images_calculees( d );
+	ok &= isomorphe_a_la_reconstruction( d, automate );
+	TEST(
+		1
+		&& ok
+		&& nb_parties > taille_ensemble( get_etats( deterministe ) )
+		&& nombre_parties_memorisees( d ) 
+			== taille_ensemble( get_etats( deterministe ) )
+		&& nombre_images_calculees( d ) == nb_images_4,
+		resultat
+	);
+
+	// Ajouts d'états finaux, de transitions, de lettres et d'états.
+	ajouter_etat_final( automate, 3 );
+	ok = isomorphe_a_la_reconstruction( d, automate );
+	ajouter_transition( automate, 2, 'c', 0 );
+	ok &= isomorphe_a_la_reconstruction( d, automate );
+	ajouter_transition( automate, k+2, 'a', 0 );
+	ajouter_transition( automate, 0, 'c', k+2 );
+	ok &= isomorphe_a_la_reconstruction( d, automate );
+	ajouter_etat_initial( automate, 4 );
+	ok &= isomorphe_a_la_reconstruction( d, automate );
+	TEST( ok, resultat );
+
+	// La destruction libère l'observateur : une nouvelle déterminisation 
+	// peut suivre le même automate.
+	liberer_determinisation_incrementale( d );
+	d = creer_determinisation_incrementale( automate );
+	ajouter_transition( automate, 1, 'c', 3 );
+	TEST( isomorphe_a_la_reconstruction( d, automate ), resultat );
+	liberer_determinisation_incrementale( d );
+	liberer_automate( automate );
+
+	// Modifications tirées au hasard.
+	srand( 2015 );
+	ok = 1;
+	int essai;
+	for( essai=0; essai<20; essai++ ){
+		automate = creer_automate();
+		int n = 2 + rand() % 10;
+		ajouter_etat_initial( automate, rand() % n );
+		d = creer_determinisation_incrementale( automate );
+		int t;
+		for( t=0; t<4*n; t++ ){
+			int choix = rand() % 8;
+			if( choix == 0 ){
+				ajouter_etat_final( automate, rand() % n );
+			}else if( choix == 1 ){
+				retirer_etat_final( automate, rand() % n );
+			}else if( choix == 2 ){
+				retirer_transition( automate, rand() % n, 'a' + rand() % 3, rand() % n );
+			}else{
+				ajouter_transition( automate, rand() % n, 'a' + rand() % 3, rand() % n );
+			}
+			if( t % 3 == 0 ) ok &= isomorphe_a_la_reconstruction( d, automate );
+			if( t % 7 == 0 ) compacter_determinisation_incrementale( d );
+		}
+		ok &= isomorphe_a_la_reconstruction( d, automate );
+		liberer_determinisation_incrementale( d );
+		liberer_automate( automate );
+	}
+	TEST( ok, resultat );
+
+	return resultat;
+}
+
+int main(){
+
+	if( ! test_determinisation_incrementale() ){ return 1; }
+
+	return 0;
+}
@@ -0,0 +1,124 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+
+
+#include "automate.h"
+#include "outils.h"
+#include "ensemble.h"
+
+#include <stdlib.h>
+
+typedef struct {
+	const Automate * autre;
+	int ok;
+} Comparaison_transitions;
+
+void verifier_transition( int origine, char lettre, int fin, void* data ){
+	Comparaison_transitions * c = data;
+	c->ok &= est_une_transition_de_l_automate( c->autre, origine, lettre, fin );
+}
+
+int automates_identiques( const Automate * a1, const Automate * a2 ){
+	Comparaison_transitions c = { a2, 1 };
+	pour_toute_transition( a1, verifier_transition, &c );
+	return c.ok
+		&& nombre_de_transitions( a1 ) == nombre_de_transitions( a2 )
+		&& comparer_ensemble( get_etats( a1 ), get_etats( a2 ) ) == 0
+		&& comparer_ensemble( get_initiaux( a1 ), get_initiaux( a2 ) ) == 0
+		&& comparer_ensemble( get_finaux( a1 ), get_finaux( a2 ) ) == 0
+		&& comparer_ensemble( get_alphabet( a1 ), get_alphabet( a2 ) ) == 0;
+}
+
+int meme_determinisation_parallele( const Automate * automate ){
+	Automate * serie = creer_automate_deterministe( automate );
+	int ok = 1;
+	int nb_threads;
+	for( nb_threads=1; nb_threads<=8; nb_threads *= 2 ){
+		Automate * parallele = 
+			creer_automate_deterministe_parallele( automate, nb_threads );
+		ok &= automates_identiques( serie, parallele );
+		liberer_automate( parallele );
+	}
+	liberer_automate( serie );
+	return ok;
+}
+
+int test_determinisation_parallele(){
+	int resultat = 1;
+
+	// (a+b+c)*.a.(a+b+c)^k : 2^(k+1) parties accessibles.
+	int k = 9;
+	Automate * automate = creer_automate();
+	ajouter_etat_initial( automate, 0 );
+	ajouter_transition( automate, 0, 'a', 0 );
+	ajouter_transition( automate, 0, 'b', 0 );
+	ajouter_transition( automate, 0, 'c', 0 );
+	ajouter_transition( automate, 0, 'a', 1 );
+	int i;
+	for( i=1; i<=k; i++ ){
+		ajouter_transition( automate, i, 'a', i+1 );
+		ajouter_transition( automate, i, 'b', i+1 );
+		ajouter_transition( automate, i, 'c', i+1 );
+	}
+	ajouter_etat_final( automate, k+1 );
+
+	int ok = meme_determinisation_parallele( automate );
+	Automate * parallele = creer_automate_deterministe_parallele( automate, 4 );
+	TEST(
+		1
+		&& ok
+		&& taille_ensemble( get_etats( parallele ) ) == 1 << (k+1)
+		&& le_mot_est_reconnu( parallele, "acccccccbc" )
+		&& ! le_mot_est_reconnu( parallele, "cacccccccc" ),
+		resultat
+	);
+	liberer_automate( parallele );
+	liberer_automate( automate );
+
+	// Automates non déterministes tirés au hasard.
+	srand( 2015 );
+	ok = 1;
+	int essai;
+	for( essai=0; essai<50; essai++ ){
+		automate = creer_automate();
+		int n = 2 + rand() % 12;
+		ajouter_etat_initial( automate, rand() % n );
+		ajouter_etat_initial( automate, rand() % n );
+		ajouter_etat_final( automate, rand() % n );
+		int t;
+		for( t=0; t<3*n; t++ ){
+			ajouter_transition( automate, rand() % n, 'a' + rand() % 3, rand() % n );
+		}
+		ok &= meme_determinisation_parallele( automate );
+		liberer_automate( automate );
+	}
+	TEST( ok, resultat );
+
+	return resultat;
+}
+
+int main(){
+
+	if( ! test_determinisation_parallele() ){ return 1; }
+
+	return 0;
+}
@@ -0,0 +1,171 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+
+#include "automate.h"
+#include "dictionnaire.h"
+#include "outils.h"
+#include "ensemble.h"
+
+#include <string.h>
+
+int test_dictionnaire(){
+	int resultat = 1;
+
+	{
+		const char * mots[] = { "tap", "taps", "top", "tops" };
+		Automate * automate = creer_automate_dictionnaire( mots, 4 );
+
+		TEST(
+			1
+			&& automate
+			&& taille_ensemble( get_etats( automate ) ) == 5
+			&& nombre_de_transitions( automate ) == 5
+			&& taille_ensemble( get_initiaux( automate ) ) == 1
+			&& le_mot_est_reconnu( automate, "tap" )
+			&& le_mot_est_reconnu( automate, "taps" )
+			&& le_mot_est_reconnu( automate, "top" )
+			&& le_mot_est_reconnu( automate, "tops" )
+			&& ! le_mot_est_reconnu( automate, "" )
+			&& ! le_mot_est_reconnu( automate, "ta" )
+			&& ! le_mot_est_reconnu( automate, "tapss" ),
+			resultat
+		);
+
+		liberer_automate( automate );
+	}
+
+	{
+		Dictionnaire * dictionnaire = creer_dictionnaire();
+		int ajouts = 1;
+
+		ajouts &= ajouter_mot_dictionnaire( dictionnaire, "" );
+		ajouts &= ajouter_mot_dictionnaire( dictionnaire, "ab" );
+		ajouts &= ajouter_mot_dictionnaire( dictionnaire, "ab" );
+		ajouts &= ajouter_mot_dictionnaire( dictionnaire, "b" );
+		int desordre = ajouter_mot_dictionnaire( dictionnaire, "aa" );
+
+		TEST( ajouts && ! desordre, resultat );
+
+		Automate * automate = terminer_dictionnaire( dictionnaire );
+		liberer_dictionnaire( dictionnaire );
+
+		TEST(
+			1
+			&& le_mot_est_reconnu( automate, "" )
+			&& le_mot_est_reconnu( automate, "ab" )
+			&& le_mot_est_reconnu( automate, "b" )
+			&& ! le_mot_est_reconnu( automate, "a" )
+			&& ! le_mot_est_reconnu( automate, "aa" )
+			&& taille_ensemble( get_etats( automate ) ) == 3,
+			resultat
+		);
+
+		liberer_automate( automate );
+	}
+
+	{
+		Automate * automate = creer_automate_dictionnaire( NULL, 0 );
+
+		TEST(
+			1
+			&& taille_ensemble( get_etats( automate ) ) == 1
+			&& taille_ensemble( get_finaux( automate ) ) == 0
+			&& ! le_mot_est_reconnu( automate, "" ),
+			resultat
+		);
+
+		liberer_automate( automate );
+	}
+
+	return resultat;
+}
+
+int test_index_mots(){
+	int resultat = 1;
+
+	{
+		const char * mots[] = { "", "a", "ab", "abc", "b", "ba", "bc", "c" };
+		Automate * automate = creer_automate_dictionnaire( mots, 8 );
+		Index_mots * index = creer_index_mots( automate );
+
+		int ok = index && nombre_de_mots_index( index ) == 8;
+		int i;
+		for( i=0; ok && i<8; i++ ){
+			char * mot = mot_du_numero( index, i );
+			ok = ok 
+				&& numero_du_mot( index, mots[i] ) == i
+				&& mot && strcmp( mot, mots[i] ) == 0;
+			xfree( mot );
+		}
+
+		TEST(
+			1
+			&& ok
+			&& numero_du_mot( index, "bb" ) == -1
+			&& numero_du_mot( index, "abcd" ) == -1
+			&& mot_du_numero( index, 8 ) == NULL
+			&& mot_du_numero( index, -1 ) == NULL,
+			resultat
+		);
+
+		liberer_index_mots( index );
+		liberer_automate( automate );
+	}
+
+	{
+		Automate * automate = creer_automate();
+		ajouter_etat_initial( automate, 0 );
+		ajouter_etat_final( automate, 1 );
+		ajouter_transition( automate, 0, 'a', 1 );
+		ajouter_transition( automate, 0, 'b', 2 );
+		ajouter_transition( automate, 2, 'a', 1 );
+		Automate * minimal = creer_automate_minimal( automate );
+		Index_mots * index = creer_index_mots( minimal );
+
+		TEST(
+			1
+			&& index
+			&& nombre_de_mots_index( index ) == 2
+			&& numero_du_mot( index, "a" ) == 0
+			&& numero_du_mot( index, "ba" ) == 1
+			&& numero_du_mot( index, "b" ) == -1,
+			resultat
+		);
+
+		liberer_index_mots( index );
+		ajouter_transition( automate, 1, 'a', 0 );
+		TEST( creer_index_mots( automate ) == NULL, resultat );
+
+		liberer_automate( minimal );
+		liberer_automate( automate );
+	}
+
+	return resultat;
+}
+
+int main(){
+
+	if( ! test_dictionnaire() ){ return 1; }
+	if( ! test_index_mots() ){ return 1; }
+
+	return 0;
+}
@@ -0,0 +1,128 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "automate.h"
+#include "echantillonnage.h"
+#include "enumeration.h"
+#include "outils.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+int test_echantillonnage(){
+	int resultat = 1;
+
+	// Mots sur {a, b} sans facteur bb : 8 mots de longueur 4.
+	Automate * automate = creer_automate();
+	ajouter_transition( automate, 0, 'a', 0 );
+	ajouter_transition( automate, 0, 'b', 1 );
+	ajouter_transition( automate, 1, 'a', 0 );
+	ajouter_transition( automate, 1, 'b', 2 );
+	ajouter_transition( automate, 2, 'a', 2 );
+	ajouter_transition( automate, 2, 'b', 2 );
+	ajouter_etat_initial( automate, 0 );
+	ajouter_etat_final( automate, 0 );
+	ajouter_etat_final( automate, 1 );
+
+	// Chaque mot est tiré environ 10000 fois sur 80000 tirages.
+	Echantillonneur * e = creer_echantillonneur( automate, 4, 2015 );
+	Enumerateur * enumerateur = creer_enumerateur( automate );
+	const int nb_tirages = 80000;
+	char * tampon = xmalloc( nb_tirages * 5 );
+	int effectifs[8] = { 0 };
+	int ok = tirer_mots( e, nb_tirages, tampon ) == (size_t) nb_tirages;
+	int i;
+	for( i=0; i<nb_tirages; i++ ){
+		uint64_t rang;
+		ok &= rang_du_mot( enumerateur, tampon + 5 * i, &rang ) && rang < 8;
+		if( ok ) effectifs[rang]++;
+	}
+	for( i=0; i<8; i++ ){
+		ok &= effectifs[i] > 9500 && effectifs[i] < 10500;
+	}
+	TEST( ok, resultat );
+	liberer_enumerateur( enumerateur );
+	liberer_echantillonneur( e );
+
+	// Une même graine donne les mêmes tirages, un par un ou par lots.
+	e = creer_echantillonneur( automate, 4, 2015 );
+	char mot[5];
+	ok = 1;
+	for( i=0; i<1000; i++ ){
+		ok &= tirer_mot( e, mot ) && strcmp( mot, tampon + 5 * i ) == 0;
+	}
+	TEST( ok, resultat );
+	liberer_echantillonneur( e );
+	xfree( tampon );
+
+	// Mots longs : les comptes dépassent largement 2^64.
+	e = creer_echantillonneur( automate, 2000, 1 );
+	char * long_mot = xmalloc( 2001 );
+	ok = 1;
+	for( i=0; i<100; i++ ){
+		ok &= tirer_mot( e, long_mot ) && strlen( long_mot ) == 2000
+			&& le_mot_est_reconnu( automate, long_mot );
+	}
+	TEST( ok, resultat );
+	xfree( long_mot );
+	liberer_echantillonneur( e );
+	liberer_automate( automate );
+
+	// a*, avec une boucle sur {a, b} inaccessible : ses comptes, en 2^1200, 
+	// ne font pas disparaître l'unique mot a^1200.
+	automate = creer_automate();
+	ajouter_transition( automate, 0, 'a', 0 );
+	ajouter_transition( automate, 1, 'a', 1 );
+	ajouter_transition( automate, 1, 'b', 1 );
+	ajouter_etat_initial( automate, 0 );
+	ajouter_etat_final( automate, 0 );
+	ajouter_etat_final( automate, 1 );
+	e = creer_echantillonneur( automate, 1200, 1 );
+	long_mot = xmalloc( 1201 );
+	ok = tirer_mot( e, long_mot ) && strspn( long_mot, "a" ) == 1200;
+	TEST( ok, resultat );
+	xfree( long_mot );
+	liberer_echantillonneur( e );
+	liberer_automate( automate );
+
+	// Aucun mot de longueur impaire dans (aa)*.
+	automate = creer_automate();
+	ajouter_transition( automate, 0, 'a', 1 );
+	ajouter_transition( automate, 1, 'a', 0 );
+	ajouter_etat_initial( automate, 0 );
+	ajouter_etat_final( automate, 0 );
+	e = creer_echantillonneur( automate, 3, 1 );
+	TEST( ! tirer_mot( e, mot ) && tirer_mots( e, 1, mot ) == 0, resultat );
+	liberer_echantillonneur( e );
+	e = creer_echantillonneur( automate, 4, 1 );
+	TEST( tirer_mot( e, mot ) && strcmp( mot, "aaaa" ) == 0, resultat );
+	liberer_echantillonneur( e );
+	liberer_automate( automate );
+
+	return resultat;
+}
+
+int main(){
+
+	if( ! test_echantillonnage() ){ return 1; }
+
+	return 0;
+}
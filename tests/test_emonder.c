@@ -0,0 +1,98 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "automate.h"
+#include "outils.h"
+#include "ensemble.h"
+
+int test_emonder(){
+	int resultat = 1;
+
+	// 10 -a-> 20 -b-> 30 (final) ; 20 -a-> 40 (puits) ; 50 -a-> 30 
+	// (inaccessible) ; 60 isolé.
+	Automate * automate = creer_automate();
+	ajouter_etat_initial( automate, 10 );
+	ajouter_transition( automate, 10, 'a', 20 );
+	ajouter_transition( automate, 20, 'b', 30 );
+	ajouter_transition( automate, 20, 'a', 40 );
+	ajouter_transition( automate, 40, 'c', 40 );
+	ajouter_transition( automate, 50, 'a', 30 );
+	ajouter_etat( automate, 60 );
+	ajouter_etat_final( automate, 30 );
+
+	Automate * emonde = emonder( automate );
+	TEST(
+		1
+		&& taille_ensemble( get_etats( emonde ) ) == 3
+		&& get_max_etat( emonde ) == 2
+		&& taille_ensemble( get_initiaux( emonde ) ) == 1
+		&& est_un_etat_initial_de_l_automate( emonde, 0 )
+		&& taille_ensemble( get_finaux( emonde ) ) == 1
+		&& est_un_etat_final_de_l_automate( emonde, 2 )
+		&& taille_ensemble( get_alphabet( emonde ) ) == 3
+		&& nombre_de_transitions( emonde ) == 2
+		&& est_une_transition_de_l_automate( emonde, 0, 'a', 1 )
+		&& est_une_transition_de_l_automate( emonde, 1, 'b', 2 )
+		&& le_mot_est_reconnu( emonde, "ab" ),
+		resultat
+	);
+	liberer_automate( emonde );
+
+	// Les parties contenant le puits disparaissent de la déterminisation.
+	Automate * deterministe = creer_automate_deterministe( automate );
+	Automate * deterministe_emonde = 
+		creer_automate_deterministe_avec_options( automate, OPTION_EMONDAGE );
+	TEST(
+		1
+		&& taille_ensemble( get_etats( deterministe ) ) == 5
+		&& taille_ensemble( get_etats( deterministe_emonde ) ) == 4
+		&& le_mot_est_reconnu( deterministe_emonde, "ab" )
+		&& ! le_mot_est_reconnu( deterministe_emonde, "aa" ),
+		resultat
+	);
+	liberer_automate( deterministe );
+	liberer_automate( deterministe_emonde );
+	liberer_automate( automate );
+
+	// Langage vide : il ne reste aucun état.
+	automate = creer_automate();
+	ajouter_etat_initial( automate, 0 );
+	ajouter_transition( automate, 0, 'a', 1 );
+	ajouter_etat_final( automate, 2 );
+	emonde = emonder( automate );
+	TEST(
+		1
+		&& taille_ensemble( get_etats( emonde ) ) == 0
+		&& taille_ensemble( get_initiaux( emonde ) ) == 0
+		&& taille_ensemble( get_alphabet( emonde ) ) == 1,
+		resultat
+	);
+	liberer_automate( emonde );
+	liberer_automate( automate );
+
+	return resultat;
+}
+
+int main(){
+
+	if( ! test_emonder() ){ return 1; }
+
+	return 0;
+}
@@ -0,0 +1,181 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "automate.h"
+#include "enumeration.h"
+#include "outils.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * Compare l'énumération aux mots de longueur au plus 'longueur_max' 
+ * reconnus, engendrés par force brute dans l'ordre militaire.
+ */
+int enumeration_par_force_brute( 
+	const Automate * automate, const char * lettres, int longueur_max 
+){
+	Enumerateur * e = creer_enumerateur( automate );
+	int nb_lettres = strlen( lettres );
+	char mot[16];
+	int indices[16];
+	int ok = 1;
+	int longueur, i;
+	for( longueur=0; longueur<=longueur_max; longueur++ ){
+		for( i=0; i<longueur; i++ ) indices[i] = 0;
+		uint64_t rang = 0;
+		while( 1 ){
+			for( i=0; i<longueur; i++ ) mot[i] = lettres[ indices[i] ];
+			mot[longueur] = '\0';
+			if( le_mot_est_reconnu( automate, mot ) ){
+				const char * suivant = mot_suivant( e );
+				ok &= suivant && strcmp( suivant, mot ) == 0;
+				uint64_t r;
+				char retrouve[16];
+				ok &= rang_du_mot( e, mot, &r ) && r == rang;
+				ok &= mot_de_rang( e, longueur, rang, retrouve ) 
+					&& strcmp( retrouve, mot ) == 0;
+				rang++;
+			}else{
+				uint64_t r;
+				ok &= ! rang_du_mot( e, mot, &r );
+			}
+			for( i=longueur-1; i>=0 && indices[i] == nb_lettres - 1; i-- ){
+				indices[i] = 0;
+			}
+			if( i < 0 ) break;
+			indices[i]++;
+		}
+		ok &= nombre_de_mots_enumerateur( e, longueur ) == rang;
+		ok &= ! mot_de_rang( e, longueur, rang, mot );
+	}
+	liberer_enumerateur( e );
+	return ok;
+}
+
+int test_enumeration(){
+	int resultat = 1;
+
+	// Mots sur {a, b} sans facteur bb.
+	Automate * automate = creer_automate();
+	ajouter_transition( automate, 0, 'a', 0 );
+	ajouter_transition( automate, 0, 'b', 1 );
+	ajouter_transition( automate, 1, 'a', 0 );
+	ajouter_transition( automate, 1, 'b', 2 );
+	ajouter_transition( automate, 2, 'a', 2 );
+	ajouter_transition( automate, 2, 'b', 2 );
+	ajouter_etat_initial( automate, 0 );
+	ajouter_etat_final( automate, 0 );
+	ajouter_etat_final( automate, 1 );
+
+	Enumerateur * e = creer_enumerateur( automate );
+	const char * attendus[] = { 
+		"", "a", "b", "aa", "ab", "ba", "aaa", "aab", "aba", "baa", "bab", "aaaa" 
+	};
+	int ok = 1;
+	int i;
+	for( i=0; i<12; i++ ){
+		const char * mot = mot_suivant( e );
+		ok &= mot && strcmp( mot, attendus[i] ) == 0;
+	}
+	TEST( ok, resultat );
+
+	// Partage des mots de longueur 30 en intervalles de rangs.
+	uint64_t nb = nombre_de_mots_enumerateur( e, 30 );
+	TEST( nb == 2178309, resultat );
+	Enumerateur * morceau = creer_enumerateur( automate );
+	ok = positionner_enumerateur( e, 30, 0 );
+	uint64_t debut;
+	for( debut=0; debut<nb; debut+=1000003 ){
+		ok &= positionner_enumerateur( morceau, 30, debut );
+		uint64_t r;
+		for( r=debut; r<nb && r<debut+1000003; r++ ){
+			const char * attendu = mot_suivant( e );
+			const char * mot = mot_suivant( morceau );
+			if( r % 1000 == 0 ) ok &= strcmp( attendu, mot ) == 0;
+		}
+	}
+	ok &= strlen( mot_suivant( e ) ) == 31;
+	TEST( ok, resultat );
+	liberer_enumerateur( morceau );
+	liberer_enumerateur( e );
+	TEST( enumeration_par_force_brute( automate, "ab", 10 ), resultat );
+	liberer_automate( automate );
+
+	// Langage fini : {ab, b, ba}.
+	automate = creer_automate();
+	ajouter_transition( automate, 0, 'a', 1 );
+	ajouter_transition( automate, 1, 'b', 2 );
+	ajouter_transition( automate, 0, 'b', 3 );
+	ajouter_transition( automate, 3, 'a', 2 );
+	ajouter_etat_initial( automate, 0 );
+	ajouter_etat_final( automate, 2 );
+	ajouter_etat_final( automate, 3 );
+	e = creer_enumerateur( automate );
+	const char * premier = mot_suivant( e );
+	TEST( premier && strcmp( premier, "b" ) == 0, resultat );
+	const char * deuxieme = mot_suivant( e );
+	TEST( deuxieme && strcmp( deuxieme, "ab" ) == 0, resultat );
+	const char * troisieme = mot_suivant( e );
+	TEST( troisieme && strcmp( troisieme, "ba" ) == 0, resultat );
+	TEST( mot_suivant( e ) == NULL && mot_suivant( e ) == NULL, resultat );
+	TEST( ! positionner_enumerateur( e, 2, 2 ) && mot_suivant( e ) == NULL, resultat );
+	liberer_enumerateur( e );
+	liberer_automate( automate );
+
+	// Langage vide.
+	automate = creer_automate();
+	ajouter_transition( automate, 0, 'a', 0 );
+	ajouter_etat_initial( automate, 0 );
+	e = creer_enumerateur( automate );
+	TEST( mot_suivant( e ) == NULL, resultat );
+	liberer_enumerateur( e );
+	liberer_automate( automate );
+
+	// Automates déterministes aléatoires.
+	srand( 2015 );
+	ok = 1;
+	int essai;
+	for( essai=0; essai<30; essai++ ){
+		Automate * aleatoire = creer_automate();
+		int n = 1 + rand() % 6;
+		int t;
+		for( t=0; t<3*n; t++ ){
+			ajouter_transition( aleatoire, rand() % n, 'a' + rand() % 3, rand() % n );
+		}
+		ajouter_etat_initial( aleatoire, 0 );
+		ajouter_etat_final( aleatoire, rand() % n );
+		automate = creer_automate_deterministe( aleatoire );
+		ok &= enumeration_par_force_brute( automate, "abc", 6 );
+		liberer_automate( automate );
+		liberer_automate( aleatoire );
+	}
+	TEST( ok, resultat );
+
+	return resultat;
+}
+
+int main(){
+
+	if( ! test_enumeration() ){ return 1; }
+
+	return 0;
+}
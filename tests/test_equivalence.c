@@ -0,0 +1,117 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "automate.h"
+#include "equivalence.h"
+#include "rationnel.h"
+#include "outils.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+Automate * automate_aleatoire( int n ){
+	Automate * automate = creer_automate();
+	ajouter_etat_initial( automate, rand() % n );
+	ajouter_etat_final( automate, rand() % n );
+	if( rand() % 2 ) ajouter_etat_final( automate, rand() % n );
+	int t;
+	for( t=0; t<2*n; t++ ){
+		ajouter_transition( automate, rand() % n, 'a' + rand() % 2, rand() % n );
+	}
+	return automate;
+}
+
+/*
+ * Cherche, par énumération, un mot de longueur au plus 'max' reconnu par un
+ * seul des deux automates ; renvoie sa longueur, ou -1.
+ */
+int plus_court_mot_distinguant( 
+	const Automate * a, const Automate * b, int max 
+){
+	char mot[32];
+	int longueur;
+	for( longueur=0; longueur<=max; longueur++ ){
+		int code;
+		for( code=0; code < 1 << longueur; code++ ){
+			int i;
+			for( i=0; i<longueur; i++ ) mot[i] = 'a' + ( ( code >> i ) & 1 );
+			mot[longueur] = '\0';
+			if( le_mot_est_reconnu( a, mot ) != le_mot_est_reconnu( b, mot ) ){
+				return longueur;
+			}
+		}
+	}
+	return -1;
+}
+
+int test_equivalence(){
+	int resultat = 1;
+
+	char * mot;
+	TEST(
+		1
+		&& expressions_equivalentes( "(a.b)*.a", "a.(b.a)*", NULL )
+		&& expressions_equivalentes( "(a*.b*)*", "(a+b)*", NULL )
+		&& expressions_equivalentes( "(a*.b*)*", "(a*+b*)*", NULL )
+		&& ! expressions_equivalentes( "(a*.b*)*", "(a*+b*)", NULL ),
+		resultat
+	);
+
+	bool egaux = expressions_equivalentes( "a*", "(a+b)*", &mot );
+	TEST( ! egaux && mot && strcmp( mot, "b" ) == 0, resultat );
+	xfree( mot );
+
+	// La 4e lettre avant la fin contre la 3e : "aaa" est le plus court mot.
+	egaux = expressions_equivalentes( 
+		"(a+b)*.a.(a+b).(a+b).(a+b)", "(a+b)*.a.(a+b).(a+b)", &mot 
+	);
+	TEST( ! egaux && mot && strcmp( mot, "aaa" ) == 0, resultat );
+	xfree( mot );
+
+	// Comparaison avec l'énumération des mots courts.
+	srand( 2015 );
+	int ok = 1;
+	int essai;
+	for( essai=0; essai<300; essai++ ){
+		Automate * a = automate_aleatoire( 1 + rand() % 4 );
+		Automate * b = automate_aleatoire( 1 + rand() % 4 );
+		egaux = equivalent( a, b, &mot );
+		int longueur = plus_court_mot_distinguant( a, b, 10 );
+		if( egaux ){
+			ok &= ! mot && longueur < 0;
+		}else{
+			ok &= mot && le_mot_est_reconnu( a, mot ) != le_mot_est_reconnu( b, mot );
+			ok &= longueur < 0 ? (int) strlen( mot ) > 10 : (int) strlen( mot ) == longueur;
+			xfree( mot );
+		}
+		liberer_automate( a );
+		liberer_automate( b );
+	}
+	TEST( ok, resultat );
+
+	return resultat;
+}
+
+int main(){
+
+	if( ! test_equivalence() ){ return 1; }
+
+	return 0;
+}
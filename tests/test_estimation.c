@@ -0,0 +1,121 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+
+
+#include "automate.h"
+#include "estimation.h"
+#include "budget.h"
+#include "outils.h"
+#include "ensemble.h"
+
+// (a+b)*.a.(a+b)^k : 2^(k+1) états une fois déterminisé.
+Automate * creer_automate_estimation( int k ){
+	Automate * automate = creer_automate();
+	ajouter_etat_initial( automate, 0 );
+	ajouter_transition( automate, 0, 'a', 0 );
+	ajouter_transition( automate, 0, 'b', 0 );
+	ajouter_transition( automate, 0, 'a', 1 );
+	int i;
+	for( i=1; i<=k; i++ ){
+		ajouter_transition( automate, i, 'a', i+1 );
+		ajouter_transition( automate, i, 'b', i+1 );
+	}
+	ajouter_etat_final( automate, k+1 );
+	return automate;
+}
+
+// Le même langage, avec une boucle 'c' sur l'état final : la plupart des 
+// marches aléatoires finissent dans le puits vide.
+Automate * creer_automate_estimation_puits( int k ){
+	Automate * automate = creer_automate_estimation( k );
+	ajouter_transition( automate, k+1, 'c', k+1 );
+	return automate;
+}
+
+int test_estimer_determinisation(){
+	int resultat = 1;
+
+	Automate * automate = creer_automate_estimation( 6 );
+	Estimation_determinisation e;
+	estimer_determinisation( automate, NULL, 100, 1, &e );
+	TEST(
+		1
+		&& e.nb_etats == 8
+		&& e.nb_transitions == 15
+		&& e.nb_lettres == 2
+		&& e.lettres[0] == 'a' && e.lettres[1] == 'b'
+		&& e.degre_max[0] == 2 && e.degre_max[1] == 1
+		&& e.nb_etats_non_deterministes[0] == 1
+		&& e.nb_etats_non_deterministes[1] == 0
+		&& e.exploration_complete
+		&& e.nb_etats_explores == 128
+		&& e.estimation == 128 && e.borne_inf == 128 && e.borne_sup == 128,
+		resultat
+	);
+	liberer_automate( automate );
+
+	// Exploration partielle (jusqu'à la moitié du budget), puis 
+	// capture-recapture.
+	automate = creer_automate_estimation( 11 );
+	Budget budget;
+	initialiser_budget( &budget );
+	budget.max_etats = 6000;
+	estimer_determinisation( automate, &budget, 3000, 42, &e );
+	TEST(
+		1
+		&& ! e.exploration_complete
+		&& e.nb_etats_explores <= 3000
+		&& e.nb_etats_rencontres <= 4096
+		&& e.borne_inf <= e.estimation && e.estimation <= e.borne_sup
+		&& e.borne_sup <= 8192
+		&& e.estimation > 1000 && e.estimation <= 4096 * 2,
+		resultat
+	);
+	liberer_automate( automate );
+
+	// Avec un puits, la recapture est dégénérée : l'intervalle ne doit pas 
+	// exclure le vrai nombre d'états (2^14 + 2). Le budget s'applique aussi 
+	// aux marches : chaque pas ajoute au plus une partie.
+	automate = creer_automate_estimation_puits( 13 );
+	initialiser_budget( &budget );
+	budget.max_etats = 500;
+	estimer_determinisation( automate, &budget, 3000, 42, &e );
+	TEST(
+		1
+		&& ! e.exploration_complete
+		&& e.nb_etats_rencontres <= 501
+		&& e.proportion_absorbante >= 0.5
+		&& e.borne_inf <= 16386 && 16386 <= e.borne_sup
+		&& e.borne_sup == 32768,
+		resultat
+	);
+	liberer_automate( automate );
+
+	return resultat;
+}
+
+int main(){
+
+	if( ! test_estimer_determinisation() ){ return 1; }
+
+	return 0;
+}
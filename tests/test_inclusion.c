@@ -0,0 +1,219 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "automate.h"
+#include "inclusion.h"
+#include "rationnel.h"
+#include "outils.h"
+#include "ensemble.h"
+
+#include <stdlib.h>
+
+Automate * creer_automate_exponentiel( int k ){
+	Automate * automate = creer_automate();
+	ajouter_etat_initial( automate, 0 );
+	ajouter_transition( automate, 0, 'a', 0 );
+	ajouter_transition( automate, 0, 'b', 0 );
+	ajouter_transition( automate, 0, 'a', 1 );
+	int i;
+	for( i=1; i<=k; i++ ){
+		ajouter_transition( automate, i, 'a', i+1 );
+		ajouter_transition( automate, i, 'b', i+1 );
+	}
+	ajouter_etat_final( automate, k+1 );
+	return automate;
+}
+
+/*
+ * Inclusion calculée en déterminisant B : parcours des couples (p, q) où q 
+ * est un état du déterminisé de B, ou nb_etats_d pour l'état puits.
+ */
+int inclus_par_determinisation( const Automate * a, const Automate * b ){
+	Automate * d = creer_automate_deterministe( b );
+	int nb_etats_a = get_max_etat( a ) + 1;
+	int nb_etats_d = get_max_etat( d ) + 1;
+	int nb_couples = nb_etats_a * ( nb_etats_d + 1 );
+	char * vu = xmalloc( nb_couples );
+	int * file = xmalloc( nb_couples * sizeof(int) );
+	int tete = 0, queue = 0;
+	int i;
+	for( i=0; i<nb_couples; i++ ) vu[i] = 0;
+	int q0 = nb_etats_d;
+	if( taille_ensemble( get_initiaux( d ) ) ){
+		q0 = get_element( premier_iterateur_ensemble( get_initiaux( d ) ) );
+	}
+	Ensemble_iterateur it;
+	for( 
+		it = premier_iterateur_ensemble( get_initiaux( a ) );
+		! iterateur_ensemble_est_vide( it );
+		it = iterateur_suivant_ensemble( it )
+	){
+		int c = get_element( it ) * ( nb_etats_d + 1 ) + q0;
+		if( ! vu[c] ){ vu[c] = 1; file[ queue++ ] = c; }
+	}
+	int inclus = 1;
+	while( tete < queue && inclus ){
+		int p = file[tete] / ( nb_etats_d + 1 );
+		int q = file[tete] % ( nb_etats_d + 1 );
+		tete++;
+		if( 
+			est_un_etat_final_de_l_automate( a, p ) 
+			&& ( q == nb_etats_d || ! est_un_etat_final_de_l_automate( d, q ) ) 
+		){
+			inclus = 0;
+		}
+		const char * lettre;
+		for( lettre="abc"; *lettre; lettre++ ){
+			int q2 = nb_etats_d;
+			if( q < nb_etats_d && taille_ensemble( voisins( d, q, *lettre ) ) ){
+				q2 = get_element( premier_iterateur_ensemble( voisins( d, q, *lettre ) ) );
+			}
+			Ensemble_iterateur it2;
+			for( 
+				it2 = premier_iterateur_ensemble( voisins( a, p, *lettre ) );
+				! iterateur_ensemble_est_vide( it2 );
+				it2 = iterateur_suivant_ensemble( it2 )
+			){
+				int c = get_element( it2 ) * ( nb_etats_d + 1 ) + q2;
+				if( ! vu[c] ){ vu[c] = 1; file[ queue++ ] = c; }
+			}
+		}
+	}
+	xfree( vu );
+	xfree( file );
+	liberer_automate( d );
+	return inclus;
+}
+
+Automate * automate_aleatoire( int n, int nb_lettres ){
+	Automate * automate = creer_automate();
+	ajouter_etat_initial( automate, rand() % n );
+	ajouter_etat_final( automate, rand() % n );
+	if( rand() % 2 ) ajouter_etat_final( automate, rand() % n );
+	int t;
+	for( t=0; t<2*n; t++ ){
+		ajouter_transition( automate, rand() % n, 'a' + rand() % nb_lettres, rand() % n );
+	}
+	return automate;
+}
+
+int test_inclusion(){
+	int resultat = 1;
+
+	Automate * a_etoile = creer_automate();
+	ajouter_etat_initial( a_etoile, 0 );
+	ajouter_etat_final( a_etoile, 0 );
+	ajouter_transition( a_etoile, 0, 'a', 0 );
+	Automate * a_ou_b_etoile = creer_automate();
+	ajouter_etat_initial( a_ou_b_etoile, 0 );
+	ajouter_etat_final( a_ou_b_etoile, 0 );
+	ajouter_transition( a_ou_b_etoile, 0, 'a', 0 );
+	ajouter_transition( a_ou_b_etoile, 0, 'b', 0 );
+	TEST(
+		1
+		&& est_inclus( a_etoile, a_ou_b_etoile )
+		&& ! est_inclus( a_ou_b_etoile, a_etoile )
+		&& est_universel( a_etoile )
+		&& est_universel( a_ou_b_etoile ),
+		resultat
+	);
+	liberer_automate( a_etoile );
+	liberer_automate( a_ou_b_etoile );
+
+	// Le déterminisé de B aurait 2^31 états : l'antichaîne reste petite.
+	Automate * exponentiel = creer_automate_exponentiel( 30 );
+	Automate * plus_court = creer_automate_exponentiel( 29 );
+	ajouter_transition( plus_court, 30, 'a', 31 );
+	ajouter_transition( plus_court, 30, 'b', 31 );
+	ajouter_etat_final( plus_court, 31 );
+	TEST(
+		1
+		&& est_inclus( exponentiel, exponentiel )
+		&& est_inclus( exponentiel, plus_court )
+		&& ! est_universel( exponentiel ),
+		resultat
+	);
+	liberer_automate( plus_court );
+
+	// Le budget limite le nombre de couples conservés.
+	Budget budget;
+	initialiser_budget( &budget );
+	budget.max_etats = 10;
+	bool inclus;
+	TEST( 
+		est_inclus_budget( exponentiel, exponentiel, &budget, &inclus ) 
+			== BUDGET_ETATS_DEPASSE, 
+		resultat 
+	);
+	liberer_automate( exponentiel );
+
+	// Universalité : tous les mots sur {a, b} qui finissent par a ou par b, 
+	// ou qui sont vides.
+	Automate * tout = creer_automate();
+	ajouter_etat_initial( tout, 0 );
+	ajouter_etat_final( tout, 0 );
+	ajouter_transition( tout, 0, 'a', 1 );
+	ajouter_transition( tout, 0, 'b', 2 );
+	ajouter_transition( tout, 1, 'a', 1 );
+	ajouter_transition( tout, 1, 'b', 1 );
+	ajouter_transition( tout, 1, 'b', 2 );
+	ajouter_transition( tout, 2, 'a', 2 );
+	ajouter_transition( tout, 2, 'a', 1 );
+	ajouter_transition( tout, 2, 'b', 2 );
+	ajouter_etat_final( tout, 1 );
+	TEST( ! est_universel( tout ), resultat );
+	ajouter_transition( tout, 1, 'a', 2 );
+	ajouter_transition( tout, 2, 'b', 1 );
+	ajouter_etat_final( tout, 2 );
+	TEST( est_universel( tout ), resultat );
+	liberer_automate( tout );
+
+	// Comparaison avec l'inclusion calculée par déterminisation.
+	srand( 2015 );
+	int ok = 1;
+	int essai;
+	for( essai=0; essai<300; essai++ ){
+		Automate * a = automate_aleatoire( 1 + rand() % 6, 1 + rand() % 3 );
+		Automate * b = automate_aleatoire( 1 + rand() % 6, 1 + rand() % 3 );
+		ok &= est_inclus( a, b ) == inclus_par_determinisation( a, b );
+		ok &= est_inclus( b, a ) == inclus_par_determinisation( b, a );
+		liberer_automate( a );
+		liberer_automate( b );
+	}
+	TEST( ok, resultat );
+
+	// meme_langage() fait deux tests d'inclusion.
+	TEST(
+		1
+		&& ! meme_langage( "a*", "(a+b)*" )
+		&& ! meme_langage( "(a+b)*", "a*.(a+b)" )
+		&& meme_langage( "(a+b)*.a.(a+b).(a+b)", "(a+b)*.a.(a+b).(a+b)" ),
+		resultat
+	);
+
+	return resultat;
+}
+
+int main(){
+
+	if( ! test_inclusion() ){ return 1; }
+
+	return 0;
+}
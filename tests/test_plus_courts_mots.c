@@ -0,0 +1,187 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "automate.h"
+#include "plus_courts_mots.h"
+#include "inclusion.h"
+#include "rationnel.h"
+#include "outils.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+Automate * automate_aleatoire( int n ){
+	Automate * automate = creer_automate();
+	ajouter_etat_initial( automate, rand() % n );
+	ajouter_etat_final( automate, rand() % n );
+	if( rand() % 2 ) ajouter_etat_final( automate, rand() % n );
+	int t;
+	for( t=0; t<2*n; t++ ){
+		ajouter_transition( automate, rand() % n, 'a' + rand() % 2, rand() % n );
+	}
+	return automate;
+}
+
+/*
+ * Longueur du plus court mot sur {a, b}, de longueur au plus 'max', reconnu 
+ * par 'a' et pas par 'b' (ou par 'a' seulement si 'b' est NULL), ou -1.
+ */
+int plus_court_mot_enumere( const Automate * a, const Automate * b, int max ){
+	char mot[32];
+	int longueur;
+	for( longueur=0; longueur<=max; longueur++ ){
+		int code;
+		for( code=0; code < 1 << longueur; code++ ){
+			int i;
+			for( i=0; i<longueur; i++ ) mot[i] = 'a' + ( ( code >> i ) & 1 );
+			mot[longueur] = '\0';
+			if( le_mot_est_reconnu( a, mot ) && ! ( b && le_mot_est_reconnu( b, mot ) ) ){
+				return longueur;
+			}
+		}
+	}
+	return -1;
+}
+
+/*
+ * Vérifie un témoin : NULL si et seulement si l'énumération ne trouve rien, 
+ * et sinon de la longueur trouvée par l'énumération.
+ */
+int temoin_correct( const char * mot, const Automate * a, const Automate * b ){
+	int longueur = plus_court_mot_enumere( a, b, 10 );
+	if( ! mot ) return longueur < 0;
+	if( ! le_mot_est_reconnu( a, mot ) ) return 0;
+	if( b && le_mot_est_reconnu( b, mot ) ) return 0;
+	return longueur < 0 ? (int) strlen( mot ) > 10 : (int) strlen( mot ) == longueur;
+}
+
+int test_plus_courts_mots(){
+	int resultat = 1;
+
+	// 0 -a-> 1 -b-> 2 (final), 0 -c-> 2, 3 -a-> 0, 4 isolé.
+	Automate * automate = creer_automate();
+	ajouter_etat_initial( automate, 3 );
+	ajouter_transition( automate, 0, 'a', 1 );
+	ajouter_transition( automate, 1, 'b', 2 );
+	ajouter_transition( automate, 0, 'c', 2 );
+	ajouter_transition( automate, 3, 'a', 0 );
+	ajouter_etat( automate, 4 );
+	ajouter_etat_final( automate, 2 );
+	int taille;
+	int * distance = distances_aux_finaux( automate, &taille );
+	TEST(
+		1
+		&& taille == 5
+		&& distance[0] == 1
+		&& distance[1] == 1
+		&& distance[2] == 0
+		&& distance[3] == 2
+		&& distance[4] == -1,
+		resultat
+	);
+	xfree( distance );
+	char * mot;
+	bool vide = langage_est_vide( automate, &mot );
+	TEST( ! vide && mot && strcmp( mot, "ac" ) == 0, resultat );
+	xfree( mot );
+	liberer_automate( automate );
+
+	// Non déterministe : ab et aa sont reconnus, par deux états atteints par 
+	// 'a'.
+	automate = creer_automate();
+	ajouter_etat_initial( automate, 0 );
+	ajouter_transition( automate, 0, 'a', 1 );
+	ajouter_transition( automate, 1, 'b', 3 );
+	ajouter_transition( automate, 0, 'a', 2 );
+	ajouter_transition( automate, 2, 'a', 3 );
+	ajouter_etat_final( automate, 3 );
+	mot = plus_court_mot( automate );
+	TEST( mot && strcmp( mot, "aa" ) == 0, resultat );
+	xfree( mot );
+	liberer_automate( automate );
+
+	// Deux états initiaux : b depuis le premier, a depuis le second.
+	automate = creer_automate();
+	ajouter_etat_initial( automate, 0 );
+	ajouter_etat_initial( automate, 1 );
+	ajouter_transition( automate, 0, 'b', 2 );
+	ajouter_transition( automate, 1, 'a', 2 );
+	ajouter_etat_final( automate, 2 );
+	mot = plus_court_mot( automate );
+	TEST( mot && strcmp( mot, "a" ) == 0, resultat );
+	xfree( mot );
+	liberer_automate( automate );
+
+	automate = creer_automate();
+	ajouter_etat_initial( automate, 0 );
+	ajouter_transition( automate, 0, 'a', 1 );
+	ajouter_etat_final( automate, 2 );
+	vide = langage_est_vide( automate, &mot );
+	TEST( vide && ! mot, resultat );
+	liberer_automate( automate );
+
+	// Témoins de non-inclusion et de non-universalité.
+	Automate * a_etoile = creer_automate();
+	ajouter_etat_initial( a_etoile, 0 );
+	ajouter_etat_final( a_etoile, 0 );
+	ajouter_transition( a_etoile, 0, 'a', 0 );
+	ajouter_transition( a_etoile, 0, 'b', 1 );
+	bool universel = est_universel_temoin( a_etoile, &mot );
+	TEST( ! universel && mot && strcmp( mot, "b" ) == 0, resultat );
+	xfree( mot );
+	liberer_automate( a_etoile );
+
+	bool egaux = meme_langage_temoin( 
+		"(a+b)*.a.(a+b).(a+b).(a+b)", "(a+b)*.a.(a+b).(a+b)", &mot 
+	);
+	// Les plus courts mots distinguants sont les mots de longueur 3 
+	// commençant par a.
+	TEST( ! egaux && mot && strlen( mot ) == 3 && mot[0] == 'a', resultat );
+	xfree( mot );
+	egaux = meme_langage_temoin( "(a.b)*.a", "a.(b.a)*", &mot );
+	TEST( egaux && ! mot, resultat );
+
+	// Comparaison avec l'énumération des mots courts.
+	srand( 2015 );
+	int ok = 1;
+	int essai;
+	for( essai=0; essai<300; essai++ ){
+		Automate * a = automate_aleatoire( 1 + rand() % 5 );
+		Automate * b = automate_aleatoire( 1 + rand() % 5 );
+		bool inclus = est_inclus_temoin( a, b, &mot );
+		ok &= inclus == ( mot == NULL ) && temoin_correct( mot, a, b );
+		xfree( mot );
+		langage_est_vide( a, &mot );
+		ok &= temoin_correct( mot, a, NULL );
+		xfree( mot );
+		liberer_automate( a );
+		liberer_automate( b );
+	}
+	TEST( ok, resultat );
+
+	return resultat;
+}
+
+int main(){
+
+	if( ! test_plus_courts_mots() ){ return 1; }
+
+	return 0;
+}
@@ -0,0 +1,122 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+
+
+#include "automate.h"
+#include "produit.h"
+#include "outils.h"
+#include "ensemble.h"
+
+int compter_finaux_produit( int etat, const int * etats, int nb_automates, void * data ){
+	int * nb = data;
+	(*nb)++;
+	return *nb == 2;
+}
+
+int test_creer_produit_des_automates(){
+	int resultat = 1;
+
+	// Mots ayant un nombre pair de a, et de b, et de c.
+	Automate * pairs[3];
+	char lettre;
+	for( lettre='a'; lettre<='c'; lettre++ ){
+		Automate * automate = creer_automate();
+		ajouter_etat_initial( automate, 0 );
+		ajouter_etat_final( automate, 0 );
+		char l;
+		for( l='a'; l<='c'; l++ ){
+			ajouter_transition( automate, 0, l, l == lettre ? 1 : 0 );
+			ajouter_transition( automate, 1, l, l == lettre ? 0 : 1 );
+		}
+		// Des états inaccessibles, qui ne doivent pas apparaître.
+		ajouter_transition( automate, 100, 'a', 101 );
+		ajouter_etat_final( automate, 101 );
+		pairs[ lettre - 'a' ] = automate;
+	}
+
+	int interrompu;
+	Automate * produit = creer_produit_des_automates( 
+		(const Automate * const *) pairs, 3, NULL, NULL, &interrompu 
+	);
+	TEST(
+		1
+		&& ! interrompu
+		&& taille_ensemble( get_etats( produit ) ) == 8
+		&& taille_ensemble( get_finaux( produit ) ) == 1
+		&& est_un_etat_initial_de_l_automate( produit, 0 )
+		&& nombre_de_transitions( produit ) == 24
+		&& le_mot_est_reconnu( produit, "abcacb" )
+		&& ! le_mot_est_reconnu( produit, "abcac" ),
+		resultat
+	);
+	liberer_automate( produit );
+
+	// Intersection : couples accessibles seulement.
+	Automate * intersection = creer_intersection_des_automates( pairs[0], pairs[1] );
+	TEST(
+		1
+		&& taille_ensemble( get_etats( intersection ) ) == 4
+		&& le_mot_est_reconnu( intersection, "aabbc" )
+		&& ! le_mot_est_reconnu( intersection, "aab" ),
+		resultat
+	);
+	liberer_automate( intersection );
+
+	// Arrêt au deuxième état final rencontré.
+	Automate * tout = creer_automate();
+	ajouter_etat_initial( tout, 0 );
+	ajouter_transition( tout, 0, 'a', 1 );
+	ajouter_transition( tout, 1, 'a', 2 );
+	ajouter_transition( tout, 2, 'a', 3 );
+	ajouter_etat_final( tout, 1 );
+	ajouter_etat_final( tout, 2 );
+	ajouter_etat_final( tout, 3 );
+	Automate * a_star = creer_automate();
+	ajouter_etat_initial( a_star, 0 );
+	ajouter_etat_final( a_star, 0 );
+	ajouter_transition( a_star, 0, 'a', 0 );
+	const Automate * deux[2] = { tout, a_star };
+	int nb_finaux = 0;
+	produit = creer_produit_des_automates( 
+		deux, 2, compter_finaux_produit, &nb_finaux, &interrompu 
+	);
+	TEST(
+		1
+		&& interrompu
+		&& nb_finaux == 2
+		&& taille_ensemble( get_etats( produit ) ) == 3,
+		resultat
+	);
+	liberer_automate( produit );
+	liberer_automate( tout );
+	liberer_automate( a_star );
+
+	for( lettre=0; lettre<3; lettre++ ) liberer_automate( pairs[ (int) lettre ] );
+	return resultat;
+}
+
+int main(){
+
+	if( ! test_creer_produit_des_automates() ){ return 1; }
+
+	return 0;
+}
@@ -0,0 +1,137 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "automate.h"
+#include "produit.h"
+#include "outils.h"
+#include "ensemble.h"
+
+#include <stdlib.h>
+
+typedef struct {
+	const Automate * autre;
+	int ok;
+} Comparaison_transitions;
+
+void verifier_transition( int origine, char lettre, int fin, void* data ){
+	Comparaison_transitions * c = data;
+	c->ok &= est_une_transition_de_l_automate( c->autre, origine, lettre, fin );
+}
+
+int automates_identiques( const Automate * a1, const Automate * a2 ){
+	Comparaison_transitions c = { a2, 1 };
+	pour_toute_transition( a1, verifier_transition, &c );
+	return c.ok
+		&& nombre_de_transitions( a1 ) == nombre_de_transitions( a2 )
+		&& comparer_ensemble( get_etats( a1 ), get_etats( a2 ) ) == 0
+		&& comparer_ensemble( get_initiaux( a1 ), get_initiaux( a2 ) ) == 0
+		&& comparer_ensemble( get_finaux( a1 ), get_finaux( a2 ) ) == 0
+		&& comparer_ensemble( get_alphabet( a1 ), get_alphabet( a2 ) ) == 0;
+}
+
+int meme_produit_parallele( const Automate * const * automates, int nb ){
+	Automate * serie = creer_produit_des_automates( automates, nb, NULL, NULL, NULL );
+	int ok = 1;
+	int nb_threads;
+	for( nb_threads=1; nb_threads<=8; nb_threads *= 2 ){
+		Automate * parallele = 
+			creer_produit_des_automates_parallele( automates, nb, nb_threads );
+		ok &= automates_identiques( serie, parallele );
+		liberer_automate( parallele );
+	}
+	liberer_automate( serie );
+	return ok;
+}
+
+Automate * automate_aleatoire( int n ){
+	Automate * automate = creer_automate();
+	ajouter_etat_initial( automate, rand() % n );
+	ajouter_etat_initial( automate, rand() % n );
+	ajouter_etat_final( automate, rand() % n );
+	ajouter_etat_final( automate, rand() % n );
+	int t;
+	for( t=0; t<3*n; t++ ){
+		ajouter_transition( automate, rand() % n, 'a' + rand() % 3, rand() % n );
+	}
+	return automate;
+}
+
+int test_produit_parallele(){
+	int resultat = 1;
+
+	// Compteurs modulo 7, 11 et 13 : 1001 triplets accessibles, assez pour 
+	// que plusieurs niveaux soient partagés entre les threads.
+	int modules[3] = { 7, 11, 13 };
+	Automate * compteurs[3];
+	int k, i;
+	for( k=0; k<3; k++ ){
+		compteurs[k] = creer_automate();
+		ajouter_etat_initial( compteurs[k], 0 );
+		ajouter_etat_final( compteurs[k], 0 );
+		for( i=0; i<modules[k]; i++ ){
+			ajouter_transition( compteurs[k], i, 'a', ( i+1 ) % modules[k] );
+			ajouter_transition( compteurs[k], i, 'b', ( i+k+1 ) % modules[k] );
+		}
+	}
+	int ok = meme_produit_parallele( (const Automate * const *) compteurs, 3 );
+	Automate * produit = creer_produit_des_automates_parallele( 
+		(const Automate * const *) compteurs, 3, 4 
+	);
+	TEST(
+		1
+		&& ok
+		&& taille_ensemble( get_etats( produit ) ) == 1001
+		&& taille_ensemble( get_finaux( produit ) ) == 1,
+		resultat
+	);
+	liberer_automate( produit );
+
+	Automate * intersection = creer_intersection_des_automates_parallele( 
+		compteurs[0], compteurs[1], 2 
+	);
+	Automate * attendu = creer_intersection_des_automates( compteurs[0], compteurs[1] );
+	TEST( automates_identiques( intersection, attendu ), resultat );
+	liberer_automate( intersection );
+	liberer_automate( attendu );
+	for( k=0; k<3; k++ ) liberer_automate( compteurs[k] );
+
+	// Automates non déterministes tirés au hasard.
+	srand( 2015 );
+	ok = 1;
+	int essai;
+	for( essai=0; essai<50; essai++ ){
+		Automate * automates[2];
+		automates[0] = automate_aleatoire( 2 + rand() % 12 );
+		automates[1] = automate_aleatoire( 2 + rand() % 12 );
+		ok &= meme_produit_parallele( (const Automate * const *) automates, 2 );
+		liberer_automate( automates[0] );
+		liberer_automate( automates[1] );
+	}
+	TEST( ok, resultat );
+
+	return resultat;
+}
+
+int main(){
+
+	if( ! test_produit_parallele() ){ return 1; }
+
+	return 0;
+}
@@ -0,0 +1,164 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+
+#include "automate.h"
+#include "rationnel.h"
+#include "simulation.h"
+#include "outils.h"
+#include "ensemble.h"
+
+#include <string.h>
+
+/*
+ * Renvoie 1 si les deux automates reconnaissent les mêmes mots de longueur
+ * au plus 'longueur_max' sur l'alphabet 'lettres'.
+ */
+int memes_mots_courts(
+	const Automate * a1, const Automate * a2, const char * lettres,
+	int longueur_max
+){
+	char mot[16];
+	int nb_lettres = strlen( lettres );
+	int longueur, i;
+	for( longueur=0; longueur<=longueur_max; longueur++ ){
+		int compteur[16] = {0};
+		while( 1 ){
+			for( i=0; i<longueur; i++ ) mot[i] = lettres[ compteur[i] ];
+			mot[longueur] = '\0';
+			if( le_mot_est_reconnu( a1, mot ) != le_mot_est_reconnu( a2, mot ) ){
+				return 0;
+			}
+			for( i=0; i<longueur && ++compteur[i] == nb_lettres; i++ ){
+				compteur[i] = 0;
+			}
+			if( i == longueur ) break;
+		}
+	}
+	return 1;
+}
+
+int test_reduire_par_simulation(){
+	int resultat = 1;
+
+	{
+		Automate * automate = creer_automate();
+		ajouter_etat_initial( automate, 0 );
+		ajouter_transition( automate, 0, 'a', 1 );
+		ajouter_transition( automate, 0, 'a', 2 );
+		ajouter_transition( automate, 2, 'b', 3 );
+		ajouter_etat_final( automate, 1 );
+		ajouter_etat_final( automate, 2 );
+		ajouter_etat_final( automate, 3 );
+		ajouter_lettre( automate, 'c' );
+
+		Automate * reduit = reduire_par_simulation( automate );
+
+		TEST(
+			1
+			&& taille_ensemble( get_etats( reduit ) ) == 3
+			&& nombre_de_transitions( reduit ) == 2
+			&& est_une_lettre_de_l_automate( reduit, 'c' )
+			&& memes_mots_courts( automate, reduit, "abc", 4 ),
+			resultat
+		);
+
+		liberer_automate( reduit );
+		liberer_automate( automate );
+	}
+
+	{
+		const char * expressions[] = {
+			"(a+b)*.a.(a+b)*", "(a*.b*)*.(a+b)", "a.(b+a.b)*.(a+a)", "(a.b+a.b.a)*"
+		};
+		int i;
+		for( i=0; i<4; i++ ){
+			Rationnel * rat = expression_to_rationnel( expressions[i] );
+			Automate * automate = Glushkov( rat );
+			Automate * reduit = reduire_par_simulation( automate );
+
+			TEST(
+				1
+				&& taille_ensemble( get_etats( reduit ) ) 
+					<= taille_ensemble( get_etats( automate ) )
+				&& nombre_de_transitions( reduit ) 
+					<= nombre_de_transitions( automate )
+				&& memes_mots_courts( automate, reduit, "ab", 6 ),
+				resultat
+			);
+
+			liberer_automate( reduit );
+			liberer_automate( automate );
+			liberer_rationnel( rat );
+		}
+	}
+
+	{
+		TEST(
+			1
+			&& meme_langage_avec_options( 
+				"(a.b)*.a", "a.(b.a)*", OPTION_REDUCTION_SIMULATION 
+			)
+			&& meme_langage_avec_options( 
+				"(a*.b*)*", "(a+b)*", OPTION_REDUCTION_SIMULATION 
+			)
+			&& ! meme_langage_avec_options( 
+				"(a*.b*)*", "(a*+b*)", OPTION_REDUCTION_SIMULATION 
+			),
+			resultat
+		);
+	}
+
+	{
+		Automate * automate = creer_automate();
+		ajouter_etat_initial( automate, 0 );
+		ajouter_etat_final( automate, 2 );
+		ajouter_transition( automate, 0, 'a', 1 );
+		ajouter_transition( automate, 0, 'a', 2 );
+		ajouter_transition( automate, 0, 'b', 3 );
+
+		Automate * minimal = creer_automate_minimal( automate );
+		Automate * minimal_reduit = creer_automate_minimal_avec_options(
+			automate, OPTION_REDUCTION_SIMULATION
+		);
+
+		TEST(
+			1
+			&& taille_ensemble( get_etats( minimal ) ) 
+				== taille_ensemble( get_etats( minimal_reduit ) )
+			&& memes_mots_courts( minimal, minimal_reduit, "ab", 4 ),
+			resultat
+		);
+
+		liberer_automate( minimal_reduit );
+		liberer_automate( minimal );
+		liberer_automate( automate );
+	}
+
+	return resultat;
+}
+
+int main(){
+
+	if( ! test_reduire_par_simulation() ){ return 1; }
+
+	return 0;
+}
@@ -0,0 +1,181 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "automate.h"
+#include "rationnel.h"
+#include "requetes_chemins.h"
+#include "outils.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+typedef struct {
+	int nb_noeuds;
+	char * couples;             //!< couples[source*nb_noeuds+noeud]
+	int nb_couples;
+	int doublons;
+} Resultat_requete;
+
+void noter_couple_requete( int source, int noeud, void * data ){
+	Resultat_requete * r = data;
+	char * vu = &r->couples[ source * r->nb_noeuds + noeud ];
+	if( *vu ) r->doublons++;
+	*vu = 1;
+	r->nb_couples++;
+}
+
+/**
+ * Parcours naïf du produit depuis une seule source, avec voisins().
+ */
+void requete_naive( 
+	const Graphe_etiquete * graphe, const Automate * requete, int nb_etats, 
+	int source, char * atteints 
+){
+	char * vus = xmalloc( graphe->nb_noeuds * nb_etats );
+	int * pile = xmalloc( graphe->nb_noeuds * nb_etats * sizeof(int) );
+	memset( vus, 0, graphe->nb_noeuds * nb_etats );
+	int hauteur = 0;
+	int q;
+	for( q=0; q<nb_etats; q++ ){
+		if( est_un_etat_initial_de_l_automate( requete, q ) ){
+			vus[ source * nb_etats + q ] = 1;
+			pile[ hauteur++ ] = source * nb_etats + q;
+		}
+	}
+	while( hauteur > 0 ){
+		int couple = pile[ --hauteur ];
+		int noeud = couple / nb_etats;
+		q = couple % nb_etats;
+		if( est_un_etat_final_de_l_automate( requete, q ) ) atteints[noeud] = 1;
+		int a, r;
+		for( a=graphe->debut[noeud]; a<graphe->debut[noeud+1]; a++ ){
+			const Ensemble * fins = voisins( requete, q, graphe->lettres[a] );
+			for( r=0; r<nb_etats; r++ ){
+				int suivant = graphe->cibles[a] * nb_etats + r;
+				if( est_dans_l_ensemble( fins, r ) && ! vus[suivant] ){
+					vus[suivant] = 1;
+					pile[ hauteur++ ] = suivant;
+				}
+			}
+		}
+	}
+	xfree( vus );
+	xfree( pile );
+}
+
+int test_requetes_chemins(){
+	int resultat = 1;
+
+	// 0 -a-> 1 -b-> 2 -c-> 3, 2 -b-> 1, 3 -a-> 0.
+	int origines[] = { 0, 1, 2, 2, 3 };
+	char lettres[] = { 'a', 'b', 'c', 'b', 'a' };
+	int cibles[] = { 1, 2, 3, 1, 0 };
+	Graphe_etiquete * graphe = creer_graphe_etiquete( 
+		4, 5, origines, lettres, cibles 
+	);
+	Rationnel * rat = expression_to_rationnel( "a.(b+c)*" );
+	Automate * requete = Glushkov( rat );
+	liberer_rationnel( rat );
+
+	Resultat_requete r = { 4, xmalloc( 16 ), 0, 0 };
+	memset( r.couples, 0, 16 );
+	int source = 0;
+	requete_chemins( graphe, requete, &source, 1, noter_couple_requete, &r );
+	TEST(
+		1
+		&& r.nb_couples == 3 && r.doublons == 0
+		&& r.couples[1] && r.couples[2] && r.couples[3],
+		resultat
+	);
+	memset( r.couples, 0, 16 );
+	r.nb_couples = 0;
+	requete_chemins( graphe, requete, NULL, 0, noter_couple_requete, &r );
+	// Depuis 3 : a mène à 0 seulement ; depuis 1 et 2 : aucune arête a.
+	TEST(
+		1
+		&& r.nb_couples == 4 && r.doublons == 0
+		&& r.couples[ 3 * 4 + 0 ],
+		resultat
+	);
+	xfree( r.couples );
+	liberer_automate( requete );
+	liberer_graphe_etiquete( graphe );
+
+	// Graphes aléatoires : comparaison avec un parcours naïf par source, 
+	// avec plus de 64 sources pour couvrir plusieurs lots.
+	srand( 2015 );
+	int ok = 1;
+	int essai;
+	for( essai=0; essai<10; essai++ ){
+		int nb_noeuds = 1 + rand() % 150;
+		int nb_aretes = rand() % ( 3 * nb_noeuds + 1 );
+		int * o = xmalloc( ( nb_aretes + 1 ) * sizeof(int) );
+		char * l = xmalloc( nb_aretes + 1 );
+		int * c = xmalloc( ( nb_aretes + 1 ) * sizeof(int) );
+		int i;
+		for( i=0; i<nb_aretes; i++ ){
+			o[i] = rand() % nb_noeuds;
+			l[i] = 'a' + rand() % 3;
+			c[i] = rand() % nb_noeuds;
+		}
+		graphe = creer_graphe_etiquete( nb_noeuds, nb_aretes, o, l, c );
+		rat = expression_to_rationnel( 
+			essai % 2 ? "(a.b)*.c" : "a*.(b+c).(a+b)*" 
+		);
+		requete = Glushkov( rat );
+		liberer_rationnel( rat );
+		int nb_etats = get_max_etat( requete ) + 1;
+
+		r.nb_noeuds = nb_noeuds;
+		r.couples = xmalloc( nb_noeuds * nb_noeuds );
+		memset( r.couples, 0, nb_noeuds * nb_noeuds );
+		r.nb_couples = 0;
+		r.doublons = 0;
+		requete_chemins( graphe, requete, NULL, 0, noter_couple_requete, &r );
+		ok &= r.doublons == 0;
+		char * atteints = xmalloc( nb_noeuds );
+		int s, v;
+		for( s=0; s<nb_noeuds; s++ ){
+			memset( atteints, 0, nb_noeuds );
+			requete_naive( graphe, requete, nb_etats, s, atteints );
+			for( v=0; v<nb_noeuds; v++ ){
+				ok &= atteints[v] == r.couples[ s * nb_noeuds + v ];
+			}
+		}
+		xfree( atteints );
+		xfree( r.couples );
+		xfree( o );
+		xfree( l );
+		xfree( c );
+		liberer_automate( requete );
+		liberer_graphe_etiquete( graphe );
+	}
+	TEST( ok, resultat );
+
+	return resultat;
+}
+
+int main(){
+
+	if( ! test_requetes_chemins() ){ return 1; }
+
+	return 0;
+}
@@ -0,0 +1,108 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "rationnel.h"
+#include "outils.h"
+
+#include <stdlib.h>
+
+Signature_rationnel signature_expression( const char * expr ){
+	Rationnel * rat = expression_to_rationnel( expr );
+	Signature_rationnel signature;
+	signature_rationnel( rat, &signature );
+	liberer_rationnel( rat );
+	return signature;
+}
+
+int contient_lettre( const uint64_t * masque, char lettre ){
+	return ( masque[ (unsigned char) lettre / 64 ] >> ( (unsigned char) lettre % 64 ) ) & 1;
+}
+
+int test_signature_rationnel(){
+	int resultat = 1;
+
+	Signature_rationnel s = signature_expression( "(a+b.c)*.d.(e+f.f)" );
+	TEST(
+		1
+		&& ! s.vide
+		&& ! s.mot_vide
+		&& contient_lettre( s.alphabet, 'c' )
+		&& ! contient_lettre( s.alphabet, 'g' )
+		&& contient_lettre( s.premieres, 'a' )
+		&& contient_lettre( s.premieres, 'b' )
+		&& contient_lettre( s.premieres, 'd' )
+		&& ! contient_lettre( s.premieres, 'c' )
+		&& contient_lettre( s.dernieres, 'e' )
+		&& contient_lettre( s.dernieres, 'f' )
+		&& ! contient_lettre( s.dernieres, 'd' )
+		&& s.longueur_min == 2
+		&& s.longueur_max == -1,
+		resultat
+	);
+
+	s = signature_expression( "(a+b.c).(f+d.d.d)" );
+	TEST( s.longueur_min == 2 && s.longueur_max == 5, resultat );
+
+	signature_rationnel( NULL, &s );
+	TEST( s.vide && ! s.mot_vide, resultat );
+
+	// Des signatures différentes impliquent des langages différents ; des 
+	// signatures égales ne prouvent rien.
+	const char * paires[][2] = {
+		{ "a*", "(a+b)*" },
+		{ "a.b*", "a*.b" },
+		{ "(a.b)*", "(a.b)*.a.b" },
+		{ "a.(a+b)", "a.(a+b)*" },
+		{ "(a+b)*.a", "a.(a+b)*" },
+		{ "(a.b)*.a", "a.(b.a)*" },
+		{ "(a*.b*)*", "(a+b)*" },
+		{ "a.b+b.a", "a.a+b.b" },
+	};
+	int nb_paires = sizeof( paires ) / sizeof( paires[0] );
+	int ok = 1;
+	int nb_differentes = 0;
+	int i;
+	for( i=0; i<nb_paires; i++ ){
+		Signature_rationnel s1 = signature_expression( paires[i][0] );
+		Signature_rationnel s2 = signature_expression( paires[i][1] );
+		if( signatures_differentes( &s1, &s2 ) ){
+			nb_differentes++;
+			ok &= ! expressions_equivalentes( paires[i][0], paires[i][1], NULL );
+		}
+	}
+	TEST( ok && nb_differentes == 5, resultat );
+
+	TEST(
+		1
+		&& ! meme_langage( "(a.b)*", "(a.b)*.a.b" )
+		&& meme_langage( "(a.b)*.a", "a.(b.a)*" )
+		&& ! meme_langage( "a.b+b.a", "a.a+b.b" ),
+		resultat
+	);
+
+	return resultat;
+}
+
+int main(){
+
+	if( ! test_signature_rationnel() ){ return 1; }
+
+	return 0;
+}
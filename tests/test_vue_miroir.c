@@ -0,0 +1,126 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "automate.h"
+#include "equivalence.h"
+#include "outils.h"
+#include "ensemble.h"
+
+#include <stdlib.h>
+
+int vue_et_miroir_concordent( Automate * automate ){
+	Automate * copie = miroir( automate );
+	const Automate * vue = vue_miroir( automate );
+	int ok = 1;
+
+	Ensemble_iterateur it;
+	for(
+		it = premier_iterateur_ensemble( get_etats( automate ) );
+		! iterateur_ensemble_est_vide( it );
+		it = iterateur_suivant_ensemble( it )
+	){
+		int etat = get_element( it );
+		ok &= est_un_etat_initial_de_l_automate( vue, etat ) 
+			== est_un_etat_final_de_l_automate( automate, etat );
+		ok &= est_un_etat_final_de_l_automate( vue, etat ) 
+			== est_un_etat_initial_de_l_automate( automate, etat );
+		char lettre;
+		for( lettre='a'; lettre<='c'; lettre++ ){
+			ok &= comparer_ensemble(
+				voisins( vue, etat, lettre ), voisins( copie, etat, lettre )
+			) == 0;
+		}
+	}
+	ok &= nombre_de_transitions( vue ) == nombre_de_transitions( copie );
+	ok &= le_mot_est_reconnu( vue, "bca" ) == le_mot_est_reconnu( copie, "bca" );
+
+	Automate * det_vue = creer_automate_deterministe( vue );
+	Automate * det_copie = creer_automate_deterministe( copie );
+	ok &= equivalent( det_vue, det_copie, NULL );
+	liberer_automate( det_vue );
+	liberer_automate( det_copie );
+
+	liberer_vue_miroir( vue );
+	liberer_automate( copie );
+	return ok;
+}
+
+int test_vue_miroir(){
+	int resultat = 1;
+
+	Automate * automate = creer_automate();
+	ajouter_transition( automate, 0, 'a', 1 );
+	ajouter_transition( automate, 1, 'b', 2 );
+	ajouter_transition( automate, 2, 'c', 2 );
+	ajouter_etat_initial( automate, 0 );
+	ajouter_etat_final( automate, 2 );
+
+	const Automate * vue = vue_miroir( automate );
+	TEST(
+		1
+		&& le_mot_est_reconnu( vue, "ccba" )
+		&& ! le_mot_est_reconnu( vue, "abc" )
+		&& est_dans_l_ensemble( voisins( vue, 2, 'b' ), 1 )
+		&& taille_ensemble( voisins( vue, 0, 'a' ) ) == 0,
+		resultat
+	);
+	liberer_vue_miroir( vue );
+
+	// La vue suit les modifications de l'automate.
+	vue = vue_miroir( automate );
+	ajouter_transition( automate, 2, 'a', 0 );
+	TEST(
+		1
+		&& est_dans_l_ensemble( voisins( vue, 0, 'a' ), 2 )
+		&& le_mot_est_reconnu( vue, "baaba" ),
+		resultat
+	);
+	liberer_vue_miroir( vue );
+	TEST( vue_et_miroir_concordent( automate ), resultat );
+	liberer_automate( automate );
+
+	srand( 2015 );
+	int ok = 1;
+	int essai;
+	for( essai=0; essai<50; essai++ ){
+		automate = creer_automate();
+		int n = 1 + rand() % 8;
+		int t;
+		for( t=0; t<3*n; t++ ){
+			ajouter_transition( automate, rand() % n, 'a' + rand() % 3, rand() % n );
+		}
+		ajouter_etat_initial( automate, rand() % n );
+		ajouter_etat_final( automate, rand() % n );
+		if( essai % 2 ) indexer_antecedents( automate );
+		ok &= vue_et_miroir_concordent( automate );
+		liberer_automate( automate );
+	}
+	TEST( ok, resultat );
+
+	return resultat;
+}
+
+int main(){
+
+	if( ! test_vue_miroir() ){ return 1; }
+
+	return 0;
+}
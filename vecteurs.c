@@ -0,0 +1,187 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2014, 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "vecteurs.h"
+#include "outils.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+struct Table_vecteurs {
+	uint64_t * donnees;
+	size_t taille_donnees;
+	size_t capacite_donnees;
+
+	int nb_vecteurs;
+	int capacite_vecteurs;
+	size_t * position;
+	int * longueur;
+	uint64_t * hache;
+
+	int * alveoles;       // Numéro de vecteur, ou -1 pour une alvéole vide.
+	size_t nb_alveoles;   // Toujours une puissance de 2.
+};
+
+Table_vecteurs * creer_table_vecteurs(){
+	Table_vecteurs * table = xmalloc( sizeof(Table_vecteurs) );
+	table->capacite_donnees = 64;
+	table->taille_donnees = 0;
+	table->donnees = xmalloc( table->capacite_donnees * sizeof(uint64_t) );
+	table->nb_vecteurs = 0;
+	table->capacite_vecteurs = 16;
+	table->position = xmalloc( table->capacite_vecteurs * sizeof(size_t) );
+	table->longueur = xmalloc( table->capacite_vecteurs * sizeof(int) );
+	table->hache = xmalloc( table->capacite_vecteurs * sizeof(uint64_t) );
+	table->nb_alveoles = 32;
+	table->alveoles = xmalloc( table->nb_alveoles * sizeof(int) );
+	memset( table->alveoles, -1, table->nb_alveoles * sizeof(int) );
+	return table;
+}
+
+void liberer_table_vecteurs( Table_vecteurs * table ){
+	xfree( table->donnees );
+	xfree( table->position );
+	xfree( table->longueur );
+	xfree( table->hache );
+	xfree( table->alveoles );
+	xfree( table );
+}
+
+uint64_t hacher_vecteur( const uint64_t * mots, int nb_mots ){
+	uint64_t h = 0x9E3779B97F4A7C15ULL ^ (uint64_t) nb_mots;
+	int i;
+	for( i=0; i<nb_mots; i++ ){
+		h ^= mots[i];
+		h *= 0xBF58476D1CE4E5B9ULL;
+		h ^= h >> 31;
+	}
+	h *= 0x94D049BB133111EBULL;
+	h ^= h >> 29;
+	return h;
+}
+
+/*
+ * Renvoie l'alvéole contenant le vecteur, ou l'alvéole vide où l'insérer.
+ */
+size_t chercher_alveole_vecteur(
+	const Table_vecteurs * table, const uint64_t * mots, int nb_mots, 
+	uint64_t h
+){
+	size_t masque = table->nb_alveoles - 1;
+	size_t a = (size_t) h & masque;
+	while( table->alveoles[a] >= 0 ){
+		int v = table->alveoles[a];
+		if(
+			table->hache[v] == h && table->longueur[v] == nb_mots
+			&& memcmp( 
+				table->donnees + table->position[v], mots,
+				nb_mots * sizeof(uint64_t)
+			) == 0
+		){
+			return a;
+		}
+		a = ( a + 1 ) & masque;
+	}
+	return a;
+}
+
+void agrandir_alveoles_vecteurs( Table_vecteurs * table ){
+	xfree( table->alveoles );
+	table->nb_alveoles *= 2;
+	table->alveoles = xmalloc( table->nb_alveoles * sizeof(int) );
+	memset( table->alveoles, -1, table->nb_alveoles * sizeof(int) );
+	size_t masque = table->nb_alveoles - 1;
+	int v;
+	for( v=0; v<table->nb_vecteurs; v++ ){
+		size_t a = (size_t) table->hache[v] & masque;
+		while( table->alveoles[a] >= 0 ) a = ( a + 1 ) & masque;
+		table->alveoles[a] = v;
+	}
+}
+
+int trouver_vecteur(
+	const Table_vecteurs * table, const uint64_t * mots, int nb_mots
+){
+	uint64_t h = hacher_vecteur( mots, nb_mots );
+	return table->alveoles[ chercher_alveole_vecteur( table, mots, nb_mots, h ) ];
+}
+
+int interner_vecteur(
+	Table_vecteurs * table, const uint64_t * mots, int nb_mots, int * nouveau
+){
+	uint64_t h = hacher_vecteur( mots, nb_mots );
+	size_t a = chercher_alveole_vecteur( table, mots, nb_mots, h );
+	if( table->alveoles[a] >= 0 ){
+		if( nouveau ) *nouveau = 0;
+		return table->alveoles[a];
+	}
+
+	if( table->nb_vecteurs == table->capacite_vecteurs ){
+		table->capacite_vecteurs *= 2;
+		table->position = xrealloc(
+			table->position, table->capacite_vecteurs * sizeof(size_t)
+		);
+		table->longueur = xrealloc(
+			table->longueur, table->capacite_vecteurs * sizeof(int)
+		);
+		table->hache = xrealloc(
+			table->hache, table->capacite_vecteurs * sizeof(uint64_t)
+		);
+	}
+	while( table->taille_donnees + nb_mots > table->capacite_donnees ){
+		table->capacite_donnees *= 2;
+		table->donnees = xrealloc(
+			table->donnees, table->capacite_donnees * sizeof(uint64_t)
+		);
+	}
+
+	int v = table->nb_vecteurs++;
+	table->position[v] = table->taille_donnees;
+	table->longueur[v] = nb_mots;
+	table->hache[v] = h;
+	memcpy( table->donnees + table->taille_donnees, mots, nb_mots * sizeof(uint64_t) );
+	table->taille_donnees += nb_mots;
+	table->alveoles[a] = v;
+
+	// Taux de remplissage maximal : 1/2.
+	if( 2 * (size_t) table->nb_vecteurs > table->nb_alveoles ){
+		agrandir_alveoles_vecteurs( table );
+	}
+	if( nouveau ) *nouveau = 1;
+	return v;
+}
+
+const uint64_t * get_vecteur(
+	const Table_vecteurs * table, int numero, int * nb_mots
+){
+	*nb_mots = table->longueur[numero];
+	return table->donnees + table->position[numero];
+}
+
+int taille_table_vecteurs( const Table_vecteurs * table ){
+	return table->nb_vecteurs;
+}
+
+size_t memoire_table_vecteurs( const Table_vecteurs * table ){
+	return sizeof(Table_vecteurs)
+		+ table->capacite_donnees * sizeof(uint64_t)
+		+ table->capacite_vecteurs * ( sizeof(size_t) + sizeof(int) + sizeof(uint64_t) )
+		+ table->nb_alveoles * sizeof(int);
+}
@@ -0,0 +1,106 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2014, 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file vecteurs.h */ 
+
+#ifndef __VECTEURS_H__
+#define __VECTEURS_H__
+
+#include <stdint.h>
+#include <stddef.h>
+
+/**
+ * @brief Table d'internement de vecteurs de mots de 64 bits.
+ *
+ * Chaque vecteur distinct inséré dans la table reçoit un numéro, attribué 
+ * dans l'ordre d'insertion à partir de 0. Les vecteurs sont stockés les uns 
+ * à la suite des autres dans une même zone mémoire, avec leur valeur de 
+ * hachage, et sont retrouvés par adressage ouvert (sondage linéaire).
+ *
+ * Un vecteur peut coder un ensemble d'entiers (ensemble de bits, ou tableau 
+ * trié d'entiers) ou un n-uplet d'entiers.
+ */
+typedef struct Table_vecteurs Table_vecteurs;
+
+/**
+ * @brief Crée une table de vecteurs vide.
+ */
+Table_vecteurs * creer_table_vecteurs();
+
+/**
+ * @brief Détruit une table de vecteurs.
+ */
+void liberer_table_vecteurs( Table_vecteurs * table );
+
+/**
+ * @brief Renvoie la valeur de hachage d'un vecteur.
+ */
+uint64_t hacher_vecteur( const uint64_t * mots, int nb_mots );
+
+/**
+ * @brief Renvoie le numéro d'un vecteur, en l'ajoutant à la table s'il n'y
+ *        est pas encore.
+ *
+ * Le vecteur est copié dans la table.
+ *
+ * @param table Une table de vecteurs.
+ * @param mots Les mots du vecteur.
+ * @param nb_mots Le nombre de mots du vecteur.
+ * @param nouveau Si différent de NULL, reçoit 1 si le vecteur a été ajouté et
+ *        0 s'il était déjà présent.
+ * @return Le numéro du vecteur.
+ */
+int interner_vecteur(
+	Table_vecteurs * table, const uint64_t * mots, int nb_mots, int * nouveau
+);
+
+/**
+ * @brief Renvoie le numéro d'un vecteur, ou -1 s'il n'est pas dans la table.
+ */
+int trouver_vecteur(
+	const Table_vecteurs * table, const uint64_t * mots, int nb_mots
+);
+
+/**
+ * @brief Renvoie le vecteur de numéro donné.
+ *
+ * La mémoire du vecteur est gérée par la table ; le pointeur renvoyé n'est 
+ * plus valide après un appel à interner_vecteur().
+ *
+ * @param table Une table de vecteurs.
+ * @param numero Le numéro du vecteur.
+ * @param nb_mots Reçoit le nombre de mots du vecteur.
+ * @return Les mots du vecteur.
+ */
+const uint64_t * get_vecteur(
+	const Table_vecteurs * table, int numero, int * nb_mots
+);
+
+/**
+ * @brief Renvoie le nombre de vecteurs de la table.
+ */
+int taille_table_vecteurs( const Table_vecteurs * table );
+
+/**
+ * @brief Renvoie la mémoire occupée par la table, en octets.
+ */
+size_t memoire_table_vecteurs( const Table_vecteurs * table );
+
+#endif